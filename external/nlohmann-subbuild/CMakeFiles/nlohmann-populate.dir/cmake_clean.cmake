@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nlohmann-populate"
+  "CMakeFiles/nlohmann-populate-complete"
+  "nlohmann-populate-prefix/src/nlohmann-populate-stamp/nlohmann-populate-build"
+  "nlohmann-populate-prefix/src/nlohmann-populate-stamp/nlohmann-populate-configure"
+  "nlohmann-populate-prefix/src/nlohmann-populate-stamp/nlohmann-populate-download"
+  "nlohmann-populate-prefix/src/nlohmann-populate-stamp/nlohmann-populate-install"
+  "nlohmann-populate-prefix/src/nlohmann-populate-stamp/nlohmann-populate-mkdir"
+  "nlohmann-populate-prefix/src/nlohmann-populate-stamp/nlohmann-populate-patch"
+  "nlohmann-populate-prefix/src/nlohmann-populate-stamp/nlohmann-populate-test"
+  "nlohmann-populate-prefix/src/nlohmann-populate-stamp/nlohmann-populate-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/nlohmann-populate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/external/nlohmann-src"
+  "/root/repo/external/nlohmann-build"
+  "/root/repo/external/nlohmann-subbuild/nlohmann-populate-prefix"
+  "/root/repo/external/nlohmann-subbuild/nlohmann-populate-prefix/tmp"
+  "/root/repo/external/nlohmann-subbuild/nlohmann-populate-prefix/src/nlohmann-populate-stamp"
+  "/root/repo/external/nlohmann-subbuild/nlohmann-populate-prefix/src"
+  "/root/repo/external/nlohmann-subbuild/nlohmann-populate-prefix/src/nlohmann-populate-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/external/nlohmann-subbuild/nlohmann-populate-prefix/src/nlohmann-populate-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/external/nlohmann-subbuild/nlohmann-populate-prefix/src/nlohmann-populate-stamp${cfgdir}") # cfgdir has leading slash
+endif()
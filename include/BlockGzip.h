@@ -0,0 +1,63 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#ifndef INCLUDE_BLOCKGZIP_H_
+#define INCLUDE_BLOCKGZIP_H_
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace jino {
+// Compresses output as a series of independent gzip members, one per block written, on up to
+// numThreads threads at once and hands them to the sink in order. Each member carries its
+// compressed size in a "JB" extra subfield (as BGZF does), so decompress() can locate every
+// member up front and inflate them in parallel. Other gzip files are inflated sequentially.
+class BlockGzip {
+ public:
+  explicit BlockGzip(std::function<void(std::string_view)>,
+                     const std::uint64_t = std::thread::hardware_concurrency());
+
+  BlockGzip()                            = delete;
+  BlockGzip(BlockGzip&&)                 = delete;
+  BlockGzip(const BlockGzip&)            = delete;
+  BlockGzip& operator=(BlockGzip&&)      = delete;
+  BlockGzip& operator=(const BlockGzip&) = delete;
+
+  void write(const std::string_view);
+  void finish();
+
+  static std::string decompress(const std::string_view,
+                                const std::uint64_t = std::thread::hardware_concurrency());
+
+ private:
+  void writeNext();
+
+  static std::string compressBlock(const std::string&);
+  static std::string inflateAll(const std::string_view);
+
+  std::function<void(std::string_view)> sink_;
+  const std::uint64_t numThreads_;
+  std::deque<std::future<std::string>> blocks_;
+};
+}  // namespace jino
+
+#endif  // INCLUDE_BLOCKGZIP_H_
@@ -21,19 +21,30 @@
 #include "BufferBase.h"
 
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 
+#include "Constants.h"
+
 namespace jino {
 class Buffers;
 
 template<class T>
 class Buffer : public BufferBase {
  public:
-  explicit Buffer(const std::string&, const std::string&, const std::uint64_t, const T&);
-  explicit Buffer(const std::string&, const std::uint64_t, const T&);
-  explicit Buffer(const char*, const char*, const std::uint64_t, const T&);
-  explicit Buffer(const char*, const std::uint64_t, const T&);
+  explicit Buffer(Buffers&, const std::string&, const std::string&, const std::uint64_t,
+                  const T&, const std::uint8_t = consts::eLinear);
+  explicit Buffer(Buffers&, const std::string&, const std::uint64_t, const T&,
+                  const std::uint8_t = consts::eLinear);
+  explicit Buffer(const std::string&, const std::string&, const std::uint64_t, const T&,
+                  const std::uint8_t = consts::eLinear);
+  explicit Buffer(const std::string&, const std::uint64_t, const T&,
+                  const std::uint8_t = consts::eLinear);
+  explicit Buffer(const char*, const char*, const std::uint64_t, const T&,
+                  const std::uint8_t = consts::eLinear);
+  explicit Buffer(const char*, const std::uint64_t, const T&,
+                  const std::uint8_t = consts::eLinear);
 
   ~Buffer();
 
@@ -47,6 +58,8 @@ class Buffer : public BufferBase {
   void print() override;
 
   std::uint64_t size() const override;
+  std::uint64_t getCount() const override;
+  std::uint64_t getSpan() const override;
   std::uint64_t getReadIndex() const override;
 
   T& at(const std::uint64_t);
@@ -55,12 +68,34 @@ class Buffer : public BufferBase {
   T& setNext();
   const T& getNext();
 
+  // Splits the buffer into equally sized partitions that are each written by a single thread
+  // through setNext(partition). Partition p holds indices from p * size() / partitions, so a
+  // partly filled partition leaves a gap rather than shifting the ones after it.
+  void partition(const std::uint64_t);
+  T& setNext(const std::uint64_t);
+
   const std::vector<T>& getData() const;
 
+  // Visits the retained records in chronological order as (start, count, values) slabs. A
+  // circular buffer that has wrapped yields two slabs, a partitioned buffer one per partition.
+  void forEachSlab(const std::function<void(const std::uint64_t, const std::uint64_t,
+                                            const T*)>&) const;
 
  private:
+  struct alignas(consts::kCacheLineSize) Partition {
+    std::vector<T> data;
+  };
+
+  std::uint64_t position(const std::uint64_t) const;
+  const T& locate(const std::uint64_t) const;
+
+  Buffers& buffers_;
   const T& var_;
-  std::vector<T> data_;
+  const std::uint8_t mode_;
+  const std::uint64_t capacity_;
+  std::vector<T> data_;  // Reserved up front, committed as records are written
+  std::vector<Partition> partitions_;
+  std::uint64_t partitionSize_;
 
   std::uint64_t readIndex_;
   std::uint64_t writeIndex_;
@@ -20,6 +20,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace jino {
 
@@ -40,12 +41,22 @@ class BufferBase {
   virtual void print() = 0;
 
   virtual std::uint64_t size() const = 0;
+  virtual std::uint64_t getCount() const = 0;
+  virtual std::uint64_t getSpan() const = 0;  // Slots up to the last record, gaps included
   virtual std::uint64_t getReadIndex() const = 0;
 
+  virtual const std::vector<std::string>& getLabels() const;  // Empty unless encoded
+  virtual void setLabels(const std::vector<std::string>&);  // Ignored unless encoded
+
+  // Records already in the output file ahead of this buffer's first, see NetCDFWriter::resume
+  void setOffset(const std::uint64_t);
+  std::uint64_t getOffset() const;
+
  protected:
   const std::string name_;
   const std::string group_;
   const std::uint8_t type_;
+  std::uint64_t offset_;
 };
 }  // namespace jino
 
@@ -27,12 +27,15 @@
 namespace jino {
 class Buffers {
  public:
+  Buffers() = default;
+  ~Buffers() = default;
+
   Buffers(Buffers&&)                 = delete;
   Buffers(const Buffers&)            = delete;
   Buffers& operator=(Buffers&&)      = delete;
   Buffers& operator=(const Buffers&) = delete;
 
-  static Buffers& get();
+  static Buffers& get();  // Process-wide default registry
 
   void record();
 
@@ -44,9 +47,6 @@ class Buffers {
   void print();
 
  private:
-  Buffers() = default;
-  ~Buffers() = default;
-
   std::map<const BufferKey, BufferBase* const> buffers_;
 };
 
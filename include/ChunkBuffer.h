@@ -0,0 +1,56 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#ifndef INCLUDE_CHUNKBUFFER_H_
+#define INCLUDE_CHUNKBUFFER_H_
+
+#include <cstdint>
+#include <functional>
+#include <streambuf>
+#include <string_view>
+#include <vector>
+
+namespace jino {
+// Write-only stream buffer that collects output into one fixed-size chunk and hands each full
+// chunk to a sink, so that peak memory does not depend on the amount written. The last, partial
+// chunk is handed over on sync.
+class ChunkBuffer : public std::streambuf {
+ public:
+  ChunkBuffer(const std::uint64_t, std::function<void(std::string_view)>);
+
+  ChunkBuffer()                              = delete;
+  ChunkBuffer(ChunkBuffer&&)                 = delete;
+  ChunkBuffer(const ChunkBuffer&)            = delete;
+  ChunkBuffer& operator=(ChunkBuffer&&)      = delete;
+  ChunkBuffer& operator=(const ChunkBuffer&) = delete;
+
+  std::uint64_t getCount() const;
+
+ protected:
+  int_type overflow(int_type) override;
+  int sync() override;
+
+ private:
+  void flushChunk();
+
+  std::vector<char> chunk_;
+  std::function<void(std::string_view)> sink_;
+  std::uint64_t count_;
+};
+}  // namespace jino
+
+#endif  // INCLUDE_CHUNKBUFFER_H_
@@ -48,6 +48,11 @@ enum eDataTypes : std::uint8_t {
   eNumberOfDataTypes
 };
 
+enum eBufferModes : std::uint8_t {
+  eLinear,
+  eCircular
+};
+
 enum eWriterThreads : std::uint8_t {
   eSingleThread,
   eMultiThread
@@ -58,18 +63,46 @@ enum eOutputThreads : std::uint8_t {
   eJSONThread
 };
 
-const std::size_t kMaxFileSizeInBytes = 1048576;  // 1MB
+enum eStateFormats : std::uint8_t {
+  eJSON,
+  eCBOR,
+  eMessagePack,
+  eNetCDF,
+  eNumberOfStateFormats
+};
+
+enum eFileFormats : std::uint8_t {
+  eNetCDF4,
+  eNetCDF4Classic,  // HDF5 storage restricted to the classic data model
+  eClassic,
+  e64BitOffset,
+  eCDF5,
+  eNumberOfFileFormats
+};
+
+const std::size_t kCacheLineSize = 64;
 const std::size_t kJsonIndentSize = 2;
+const std::size_t kStateChunkSize = 1048576;  // Bytes per write of streamed state
+const std::int32_t kStateDeflateLevel = 4;    // Compression of NetCDF state variables
+const std::size_t kDeltaBaseInterval = 10;    // Checkpoints per full state in a delta chain
+const std::uint64_t kDisklessMemoryCap = 1073741824;  // Bytes before a diskless file spills
 
 // Other strings
 constexpr std::string kSeparator = ", ";
 constexpr std::string kEmptyString = "";
+constexpr std::string kGroupSeparator = ".";  // Joins group and variable names in flat formats
 constexpr std::string kInputDir = "./input/";
 constexpr std::string kOutputDir = "./output/";
 constexpr std::string kParamsFile = "params.json";
 constexpr std::string kAttrsFile = "attrs.json";
 constexpr std::string kStateFile = "state.json";
+constexpr std::string kTuningFile = "tuning.json";
 constexpr std::string kJSONExtension = ".json";
+constexpr std::string kCBORExtension = ".cbor";
+constexpr std::string kMessagePackExtension = ".msgpack";
+constexpr std::string kDeltaExtension = ".delta";
+constexpr std::string kGzipExtension = ".gz";
+constexpr std::string kIndexExtension = ".idx";
 constexpr std::string kNCExtension = ".nc";
 
 // Parameter names
@@ -80,8 +113,34 @@ constexpr std::string kWriteState = "WriteState";
 constexpr std::string kYMin = "YMin";
 constexpr std::string kYMax = "YMax";
 
+// Delta checkpoint keys
+constexpr std::string kDeltaPrevious = "previous";
+constexpr std::string kDeltaPatch = "patch";
+
+// NetCDF state names
+constexpr std::string kStateRows = "rows";
+constexpr std::string kStateValues = "values";
+constexpr std::string kCountSuffix = "_count";
+const std::string kSampleDimension = "sample_dimension";  // Too long for a constexpr string
+
+// State index keys
+constexpr std::string kIndexMembers = "members";
+constexpr std::string kIndexElements = "elements";
+
+// Variable attribute names
+constexpr std::string kFlagValues = "flag_values";
+constexpr std::string kFlagMeanings = "flag_meanings";
+
 constexpr std::string_view kDateFormat = "%Y-%m-%d_%H:%M:%S";
 
+// Indexed by eStateFormats
+const std::array<std::string, eNumberOfStateFormats> kStateExtensions = {
+  kJSONExtension,
+  kCBORExtension,
+  kMessagePackExtension,
+  kNCExtension
+};
+
 const std::array<std::string, eNumberOfDataTypes> kDataTypeNames = {
   "byte",
   "short",
@@ -104,7 +163,7 @@ const std::array<std::string, eNumberOfParams> kParamNames = {
   kYMax
 };
 
-const std::array<std::uint8_t, eNumberOfParams> kParamTypes = {
+constexpr std::array<std::uint8_t, eNumberOfParams> kParamTypes = {
   eUInt64,
   eUInt64,
   eUInt8,
@@ -18,20 +18,36 @@
 #ifndef INCLUDE_DATA_H_
 #define INCLUDE_DATA_H_
 
+#include <cstdint>
 #include <functional>
-#include <map>
-#include <memory>
 #include <string>
+#include <utility>
+#include <variant>
+#include <vector>
 
-#include "DatumBase.h"
+#include "Constants.h"
+#include "Types.h"
 
 namespace jino {
+template <typename>
+struct DataValues;
+
+template <std::size_t... Types>
+struct DataValues<std::index_sequence<Types...>> {
+  using type = std::variant<typename DataType<Types>::type...>;
+};
+
+// One of the supported types, the index of the alternative being its eDataTypes value
+using DataValue = DataValues<std::make_index_sequence<consts::eNumberOfDataTypes>>::type;
+
+// Named values kept by name in one sorted, contiguous vector. Values are held in place, so
+// building and visiting a set of attributes costs no allocation beyond the vector and long names.
 class Data {
  public:
   Data() = default;
 
-  jino::DatumBase& operator[](const std::string&);
-  const jino::DatumBase& operator[](const std::string&) const;
+  DataValue& operator[](const std::string&);
+  const DataValue& operator[](const std::string&) const;
 
   template <typename T>
   void setValue(const std::string&, const T);
@@ -39,17 +55,22 @@ class Data {
   template <typename T>
   T getValue(const std::string&) const;
 
-  void forEachDatum(const std::function<void(const std::string&, DatumBase* const)>&) const;
+  void forEachDatum(const std::function<void(const std::string&, const DataValue&)>&) const;
 
   std::uint64_t size() const;
 
   std::uint8_t contains(const std::string&) const;
 
+  void reserve(const std::uint64_t);
   void erase(const std::string&);
   void clear();
 
  private:
-  std::map<const std::string, std::unique_ptr<DatumBase>> values_;
+  std::vector<std::pair<std::string, DataValue>>::const_iterator find(const std::string&) const;
+  std::vector<std::pair<std::string, DataValue>>::const_iterator lowerBound(
+      const std::string&) const;
+
+  std::vector<std::pair<std::string, DataValue>> values_;
 };
 }  // namespace jino
 
@@ -0,0 +1,65 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#ifndef INCLUDE_DICTBUFFER_H_
+#define INCLUDE_DICTBUFFER_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Buffer.h"
+#include "Constants.h"
+
+namespace jino {
+class Buffers;
+
+// Records a low-cardinality string variable as small integer codes. The codes are written as a
+// byte variable, which every file format can hold, whose CF flag_values and flag_meanings
+// attributes hold the lookup table. The 256th label takes code -1, wrapping from 127 to -128.
+class DictBuffer : public Buffer<std::int8_t> {
+ public:
+  explicit DictBuffer(Buffers&, const std::string&, const std::string&, const std::uint64_t,
+                      const std::string&, const std::uint8_t = consts::eLinear);
+  explicit DictBuffer(Buffers&, const std::string&, const std::uint64_t, const std::string&,
+                      const std::uint8_t = consts::eLinear);
+  explicit DictBuffer(const std::string&, const std::string&, const std::uint64_t,
+                      const std::string&, const std::uint8_t = consts::eLinear);
+  explicit DictBuffer(const std::string&, const std::uint64_t, const std::string&,
+                      const std::uint8_t = consts::eLinear);
+
+  void record() override;
+  void print() override;
+
+  const std::vector<std::string>& getLabels() const override;
+  // Seeds the lookup table, e.g. with the meanings of a resumed file, so codes carry on from it
+  void setLabels(const std::vector<std::string>&) override;
+
+  std::int8_t encode(const std::string&);
+  const std::string& decode(const std::int8_t) const;
+
+  using Buffer<std::int8_t>::setNext;
+  void setNext(const std::string&);
+
+ private:
+  const std::string& label_;
+  std::int8_t code_;
+  std::vector<std::string> labels_;
+};
+}  // namespace jino
+
+#endif  // INCLUDE_DICTBUFFER_H_
@@ -15,10 +15,21 @@
 * If not, see <https://www.gnu.org/licenses/>.                                                *
 **********************************************************************************************/
 
-#include "DatumBase.h"
+#ifndef INCLUDE_INPUTS_H_
+#define INCLUDE_INPUTS_H_
 
-jino::DatumBase::DatumBase(const std::uint8_t type) : type_(type) {}
+#include <future>
 
-const std::uint8_t& jino::DatumBase::getType() const {
-  return type_;
-}
+#include "Data.h"
+
+namespace jino {
+// Model inputs being read in the background, see JsonReader::readInputs
+template <typename T>
+struct Inputs {
+  std::future<Data> attrs;
+  std::future<Data> params;
+  std::future<T> state;
+};
+}  // namespace jino
+
+#endif  // INCLUDE_INPUTS_H_
@@ -18,14 +18,39 @@
 #ifndef INCLUDE_JSONREADER_H_
 #define INCLUDE_JSONREADER_H_
 
-#include <fstream>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <future>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include "nlohmann/json.hpp"
 
 #include "Constants.h"
 #include "Data.h"
+#include "Inputs.h"
+#include "JsonScanner.h"
+#include "MappedFile.h"
+#include "NetCDFFile.h"
+#include "NetCDFState.h"
+#include "NetCDFTuning.h"
+#include "Params.h"
+#include "StateIndex.h"
+#include "StateMembers.h"
+#include "StateParser.h"
+#include "ViewBuffer.h"
 
 namespace jino {
 class JsonReader {
@@ -35,19 +60,54 @@ class JsonReader {
   void readText(const std::string&, std::string&);
 
   void readParams(jino::Data&);
+  void readParams(jino::Params&);
   void readAttrs(jino::Data&);
+  void readTuning(jino::NetCDFTuning&,
+                  const std::filesystem::path& = consts::kInputDir + consts::kTuningFile);
 
+  // Starts reading the state, attrs and params on threads of their own. Parameters and
+  // attributes arrive long before a large state, so buffers and NetCDF metadata can be set up
+  // while the state is still being parsed. Unlike readState, readAttrs and readParams, a
+  // missing or malformed file does not end the process or read as empty but is rethrown by the
+  // future's get().
   template <typename T>
-  T readState() {
-    const std::filesystem::path path(consts::kInputDir + consts::kStateFile);
+  Inputs<T> readInputs(const std::filesystem::path& path = consts::kInputDir + consts::kStateFile,
+                       const std::filesystem::path& attrsPath =
+                           consts::kInputDir + consts::kAttrsFile,
+                       const std::filesystem::path& paramsPath =
+                           consts::kInputDir + consts::kParamsFile) {
+    Inputs<T> inputs;
+    inputs.state = std::async(std::launch::async, [this, path]() {
+      return readStateFile<T>(path);
+    });
+    inputs.attrs = std::async(std::launch::async, [this, attrsPath]() {
+      Data attrs;
+      MappedFile file(attrsPath);
+      parseAttrs(file.view(), attrs);
+      return attrs;
+    });
+    inputs.params = std::async(std::launch::async, [this, paramsPath]() {
+      Data params;
+      MappedFile file(paramsPath);
+      parseParams(file.view(), params);
+      return params;
+    });
+    return inputs;
+  }
+
+  static std::uint8_t getStateFormat(const std::filesystem::path&);
+  static std::uint8_t isCompressed(const std::filesystem::path&);
+  static std::uint8_t isDelta(const std::filesystem::path&);
+
+  // The format follows the file extension (see consts::kStateExtensions). JSON state of types
+  // declared with JINO_DEFINE_TYPE_INTRUSIVE is parsed straight into the object graph, anything
+  // else is read through a full nlohmann::json document. Delta checkpoints are replayed onto
+  // the full checkpoint they descend from and compressed files are inflated in parallel first.
+  // NetCDF state can only be read into such declared types.
+  template <typename T>
+  T readState(const std::filesystem::path& path = consts::kInputDir + consts::kStateFile) {
     try {
-      std::ifstream file(path);
-      nlohmann::json j;
-      if (file.is_open()) {
-        file >> j;
-        file.close();
-      }
-      return j.get<T>();
+      return readStateFile<T>(path);
     } catch (const std::exception& error) {
       std::cout << "ERROR: Could not open file \"" << path << "\"..."<< std::endl;
       std::cerr << error.what() << std::endl;
@@ -55,10 +115,214 @@ class JsonReader {
     return T{};  // Default return in case of error
   }
 
+  // Pre-scans the state file for value boundaries, then parses vectors of reflected records in
+  // contiguous chunks of elements on up to numThreads threads, concatenating them in file order.
+  // Compressed files are inflated first, binary formats and delta checkpoints are read
+  // sequentially.
+  template <typename T> requires HasMembers<T>
+  T readStateParallel(const std::uint64_t numThreads = std::thread::hardware_concurrency(),
+                      const std::filesystem::path& path = consts::kInputDir + consts::kStateFile) {
+    if (getStateFormat(path) != consts::eJSON || isDelta(path) == true) {
+      return readState<T>(path);
+    }
+    T state;
+    try {
+      MappedFile file(path);
+      std::string inflated;
+      const std::string_view text = getText(file, path, inflated);
+      JsonScanner scanner(text);
+      const std::uint64_t end = readMembers(scanner, 0, state,
+                                            std::max<std::uint64_t>(numThreads, 1));
+      if (scanner.skipWhitespace(end) != text.size()) {
+        throw std::runtime_error("Unexpected trailing input at offset " +
+                                 std::to_string(end) + ".");
+      }
+    } catch (const std::exception& error) {
+      std::cout << "ERROR: Could not open file \"" << path << "\"..."<< std::endl;
+      std::cerr << error.what() << std::endl;
+      return T{};
+    }
+    return state;
+  }
+
+  // Deserialises only the values at the given JSON pointers, e.g. "/cars_/3/engine_". Other
+  // subtrees of JSON state are skipped by the structural scanner without being built, and with a
+  // current StateIndex sidecar the scan starts at the indexed member or element.
+  template <typename... Ts>
+  std::tuple<Ts...> readStateParts(const std::array<std::string, sizeof...(Ts)>& pointers,
+                                   const std::filesystem::path& path =
+                                       consts::kInputDir + consts::kStateFile) {
+    std::tuple<Ts...> values;
+    try {
+      if (getStateFormat(path) != consts::eJSON || isDelta(path) == true) {
+        const nlohmann::json state = isDelta(path) == true ?
+                                     readDeltas(path) : readDocument(path);
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+          (state.at(nlohmann::json::json_pointer(pointers[Is])).get_to(std::get<Is>(values)), ...);
+        }(std::index_sequence_for<Ts...>{});
+      } else {
+        MappedFile file(path);
+        std::string inflated;
+        JsonScanner scanner(getText(file, path, inflated));
+        StateIndex index;
+        index.read(path);
+        [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+          (readPointer(scanner, index, pointers[Is], std::get<Is>(values)), ...);
+        }(std::index_sequence_for<Ts...>{});
+      }
+    } catch (const std::exception& error) {
+      std::cout << "ERROR: Could not read state from file \"" << path << "\"..."<< std::endl;
+      std::cerr << error.what() << std::endl;
+      return std::tuple<Ts...>{};
+    }
+    return values;
+  }
+
+  template <typename T>
+  T readStatePart(const std::string& pointer,
+                  const std::filesystem::path& path = consts::kInputDir + consts::kStateFile) {
+    return std::get<0>(readStateParts<T>({pointer}, path));
+  }
+
  private:
+  std::unique_ptr<MappedFile> mapText(const std::string&);
+  void parseParams(const std::string_view, jino::Data&);
+  void parseAttrs(const std::string_view, jino::Data&);
+  std::string_view getText(const MappedFile&, const std::filesystem::path&, std::string&);
+  nlohmann::json readDocument(const std::filesystem::path&);
+  nlohmann::json readDeltas(const std::filesystem::path&);
+
+  template <typename T>
+  T readStateFile(const std::filesystem::path& path) {
+    if (isDelta(path) == true) {
+      return readDeltas(path).get<T>();
+    }
+    if (getStateFormat(path) == consts::eNetCDF) {
+      if constexpr (HasMembers<T>) {
+        T state;
+        std::lock_guard<std::recursive_mutex> lock(NetCDFFile::getMutex());
+        NetCDFState file(path, netCDF::NcFile::read);
+        file.read(state);
+        return state;
+      } else {
+        throw std::invalid_argument("NetCDF state needs a type declared with "
+                                    "JINO_DEFINE_TYPE_INTRUSIVE.");
+      }
+    }
+    MappedFile file(path);
+    std::string inflated;
+    const std::string_view text = getText(file, path, inflated);
+    const std::uint8_t format = getStateFormat(path);
+    if (format == consts::eCBOR) {
+      return nlohmann::json::from_cbor(text.begin(), text.end()).get<T>();
+    } else if (format == consts::eMessagePack) {
+      return nlohmann::json::from_msgpack(text.begin(), text.end()).get<T>();
+    } else if constexpr (HasMembers<T>) {
+      T state;
+      ViewBuffer buffer(text);
+      StateParser parser(buffer);
+      parser.read(state);
+      parser.finish();
+      return state;
+    } else {
+      return nlohmann::json::parse(text.begin(), text.end()).get<T>();
+    }
+  }
+
   template <typename T>
   void setValue(jino::Data&, const std::string&, const T&);
   void setValue(jino::Data&, const std::string&, const std::uint8_t, const nlohmann::json&);
+  template <std::uint8_t>
+  void setValue(jino::Params&, const nlohmann::json&);
+
+  template <typename T>
+  std::uint64_t readMembers(const JsonScanner& scanner, const std::uint64_t begin, T& value,
+                            const std::uint64_t numThreads) {
+    return scanner.forEachMember(begin, [&](const std::string& key, const std::uint64_t first,
+                                            const std::uint64_t last) {
+      value.forEachMember([&](const char* name, auto& member) {
+        if (key == name) {
+          readMember(scanner, first, last, member, numThreads);
+        }
+      });
+    });
+  }
+
+  template <typename T>
+  void readMember(const JsonScanner& scanner, const std::uint64_t begin, const std::uint64_t end,
+                  T& member, const std::uint64_t numThreads) {
+    if constexpr (HasMembers<T>) {
+      readMembers(scanner, begin, member, numThreads);
+    } else if constexpr (IsVector<T>::value) {
+      if constexpr (HasMembers<typename T::value_type>) {
+        readElements(scanner, begin, member, numThreads);
+      } else {
+        readValue(scanner.view(begin, end), member);
+      }
+    } else {
+      readValue(scanner.view(begin, end), member);
+    }
+  }
+
+  template <typename T>
+  void readElements(const JsonScanner& scanner, const std::uint64_t begin,
+                    std::vector<T>& elements, std::uint64_t numThreads) {
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> bounds;
+    scanner.forEachElement(begin, [&bounds](const std::uint64_t first, const std::uint64_t last) {
+      bounds.emplace_back(first, last);
+    });
+    numThreads = std::min<std::uint64_t>(numThreads, bounds.size());
+    std::vector<std::vector<T>> chunks(numThreads);
+    std::vector<std::exception_ptr> errors(numThreads);
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads);
+    for (std::uint64_t thread = 0; thread < numThreads; ++thread) {
+      threads.emplace_back([&, thread]() {
+        const std::uint64_t first = bounds.size() * thread / numThreads;
+        const std::uint64_t last = bounds.size() * (thread + 1) / numThreads;
+        try {
+          chunks[thread].reserve(last - first);
+          for (std::uint64_t index = first; index < last; ++index) {
+            readValue(scanner.view(bounds[index].first, bounds[index].second),
+                      chunks[thread].emplace_back());
+          }
+        } catch (...) {
+          errors[thread] = std::current_exception();
+        }
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+    for (const std::exception_ptr& error : errors) {
+      if (error != nullptr) {
+        std::rethrow_exception(error);
+      }
+    }
+    elements.clear();
+    elements.reserve(bounds.size());
+    for (std::vector<T>& chunk : chunks) {
+      elements.insert(elements.end(), std::make_move_iterator(chunk.begin()),
+                      std::make_move_iterator(chunk.end()));
+    }
+  }
+
+  template <typename T>
+  void readPointer(const JsonScanner& scanner, const StateIndex& index,
+                   const std::string& pointer, T& value) {
+    std::string_view remainder = pointer;
+    const std::uint64_t start = index.seek(remainder);
+    const auto [begin, end] = scanner.locate(remainder, start);
+    readValue(scanner.view(begin, end), value);
+  }
+
+  template <typename T>
+  void readValue(const std::string_view text, T& value) {
+    ViewBuffer buffer(text);
+    StateParser parser(buffer);
+    parser.read(value);
+    parser.finish();
+  }
 };
 }  // namespace jino
 
@@ -0,0 +1,73 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#ifndef INCLUDE_JSONSCANNER_H_
+#define INCLUDE_JSONSCANNER_H_
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace jino {
+// Finds value boundaries in JSON text without decoding it, so that independent parts of a
+// document can be handed to separate parsers. Offsets are relative to the start of the text.
+// Strings and nested values are skipped by searching for their structural characters 64 (AVX2),
+// 16 (SSE4.2) or one byte at a time, whichever the CPU supports. Scalars visited on the way are
+// checked against the JSON grammar, those inside a nested value only when it is parsed.
+class JsonScanner {
+ public:
+  explicit JsonScanner(const std::string_view);
+
+  JsonScanner() = delete;
+
+  std::uint64_t skipWhitespace(std::uint64_t) const;
+  std::uint64_t skipValue(std::uint64_t) const;
+
+  // Visits (key, begin, end) of each member of the object starting at the given offset and
+  // returns the offset following the object.
+  std::uint64_t forEachMember(std::uint64_t, const std::function<void(const std::string&,
+                              const std::uint64_t, const std::uint64_t)>&) const;
+  // Visits (begin, end) of each element of the array starting at the given offset and returns
+  // the offset following the array.
+  std::uint64_t forEachElement(std::uint64_t, const std::function<void(const std::uint64_t,
+                               const std::uint64_t)>&) const;
+
+  // Offsets of the first and one past the last character of the value at a JSON pointer
+  // (RFC 6901) relative to the value at the given offset, skipping everything not on the path.
+  std::pair<std::uint64_t, std::uint64_t> locate(const std::string_view,
+                                                 const std::uint64_t = 0) const;
+
+  std::string_view view(const std::uint64_t, const std::uint64_t) const;
+
+  static const char* getInstructionSet();
+
+ private:
+  std::uint64_t locateChild(std::uint64_t, const std::string&) const;
+  std::uint64_t skipString(std::uint64_t) const;
+  std::uint64_t skipNested(const std::uint64_t) const;
+  std::uint64_t skipScalar(std::uint64_t) const;
+  std::uint64_t expect(std::uint64_t, const char) const;
+
+  [[noreturn]] void fail(const std::uint64_t) const;
+
+  const std::string_view text_;
+};
+}  // namespace jino
+
+#endif  // INCLUDE_JSONSCANNER_H_
@@ -15,26 +15,35 @@
 * If not, see <https://www.gnu.org/licenses/>.                                                *
 **********************************************************************************************/
 
-#ifndef INCLUDE_DATUMBASE_H_
-#define INCLUDE_DATUMBASE_H_
+#ifndef INCLUDE_MAPPEDFILE_H_
+#define INCLUDE_MAPPEDFILE_H_
 
 #include <cstdint>
-#include <string>
+#include <filesystem>
+#include <string_view>
 
 namespace jino {
-class DatumBase {
+// Read-only memory mapping of a whole file, advised for sequential access.
+class MappedFile {
  public:
-  explicit DatumBase(const std::uint8_t);
+  explicit MappedFile(const std::filesystem::path&);
 
-  virtual ~DatumBase() = default;
+  ~MappedFile();
 
-  virtual const std::string getValueStr() const = 0;
+  MappedFile()                             = delete;
+  MappedFile(MappedFile&&)                 = delete;
+  MappedFile(const MappedFile&)            = delete;
+  MappedFile& operator=(MappedFile&&)      = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
 
-  const std::uint8_t& getType() const;
+  const char* data() const;
+  std::uint64_t size() const;
+  std::string_view view() const;
 
- protected:
-  const std::uint8_t type_;
+ private:
+  const char* data_;
+  std::uint64_t size_;
 };
 }  // namespace jino
 
-#endif  // INCLUDE_DATUMBASE_H_
+#endif  // INCLUDE_MAPPEDFILE_H_
@@ -22,14 +22,43 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <mutex>
+#include <numeric>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+#include "NetCDFTuning.h"
+
 namespace jino {
 class NetCDFFile {
  public:
   explicit NetCDFFile(const std::filesystem::path&, const netCDF::NcFile::FileMode);
   explicit NetCDFFile(const std::filesystem::path&);
+  // Creates the file in one of eFileFormats. Formats without groups hold grouped variables at
+  // the root, named "<group>.<variable>". A diskless file is built in memory and written out
+  // in one go when closed.
+  NetCDFFile(const std::filesystem::path&, const std::uint8_t, const std::uint8_t = false);
+
+  // netCDF-C and HDF5 are not thread-safe, so every thread that opens, writes or closes a file
+  // holds this for the duration, whichever writer or registry it belongs to
+  static std::recursive_mutex& getMutex();
+  // Sets the chunk cache and alignment of files created from now on. They are process-wide.
+  static void setDefaults(const NetCDFTuning&);
+  // Sets this file's fill mode and the chunk cache of the variables it goes on to add
+  void tune(const NetCDFTuning&);
+  // Bytes that count values add to the file, the characters of strings rather than their handles
+  template <typename T>
+  static std::uint64_t getBytes(const T* data, const std::uint64_t count) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      return std::accumulate(data, data + count, std::uint64_t{0},
+                             [](const std::uint64_t sum, const std::string& value) {
+        return sum + value.size();
+      });
+    } else {
+      return count * sizeof(T);
+    }
+  }
 
   ~NetCDFFile();
 
@@ -47,23 +76,50 @@ class NetCDFFile {
   template <typename T>
   void addAttribute(const std::string&, const T);
 
+  void addLabels(const std::string&, const std::string&, const std::vector<std::string>&);
+
   template <typename T>
   void addData(const std::string&, const std::vector<T>&);
 
   template <typename T>
   void addData(const std::string&, const std::string&, const std::vector<T>&);
 
+  template <typename T>
+  void addData(const std::string&, const std::uint64_t, const std::uint64_t, const T*);
+
+  template <typename T>
+  void addData(const std::string&, const std::string&, const std::uint64_t, const std::uint64_t,
+               const T*);
+
   template <typename T>
   void addDatum(const std::string&, const std::uint64_t, const T);
 
   template <typename T>
   void addDatum(const std::string&, const std::string&, const std::uint64_t, const T);
 
+  std::uint64_t getRecordCount(const std::string&, const std::string&) const;
+  std::vector<std::string> getLabels(const std::string&, const std::string&) const;
+  const std::filesystem::path& getPath() const;
+  std::uint8_t getFormat() const;
+  std::uint8_t hasGroups() const;
+  std::uint8_t isDiskless() const;
+  std::uint64_t getBytesWritten() const;  // Variable data only, approximating a diskless image
+  netCDF::NcGroup getRoot() const;
+
   void close();
 
  private:
+  netCDF::NcVar getVar(const std::string&, const std::string&) const;
+  void checkType(const std::string&, const std::string&) const;
+  void sync(const std::uint64_t);
+  void cacheVar(const netCDF::NcVar&) const;
+
   const std::filesystem::path path_;
   const netCDF::NcFile::FileMode mode_;
+  std::uint8_t format_;
+  const std::uint8_t isDiskless_;
+  std::uint64_t bytes_;
+  NetCDFTuning tuning_;
   netCDF::NcFile netCDF_;
 };
 }  // namespace monio
@@ -0,0 +1,283 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#ifndef INCLUDE_NETCDFSTATE_H_
+#define INCLUDE_NETCDFSTATE_H_
+
+#include <netcdf>
+
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "Constants.h"
+#include "NetCDFFile.h"
+#include "StateMembers.h"
+#include "Types.h"
+
+namespace jino {
+template <typename T>
+concept IsNetCDFNumber = std::is_same_v<T, bool> ||
+                         (std::is_arithmetic_v<T> && requires { Types<T>::type; });
+
+// Vectors of bool have no addressable elements and are kept as JSON instead
+template <typename T>
+concept IsNetCDFArray = IsVector<T>::value && std::is_same_v<typename T::value_type, bool> == false;
+
+// How a number is held in NetCDF, matching the overloads of netCDF::NcVar::putVar and getVar
+template <typename T>
+struct NetCDFValue {
+  using type = T;
+  static constexpr std::uint8_t dataType = Types<T>::type;
+};
+
+template <>
+struct NetCDFValue<bool> {
+  using type = std::uint8_t;
+  static constexpr std::uint8_t dataType = consts::eUInt8;
+};
+
+template <>
+struct NetCDFValue<std::uint64_t> {
+  using type = unsigned long long;  /// NOLINT(runtime/int)
+  static constexpr std::uint8_t dataType = consts::eUInt64;
+};
+
+// Maps state onto the groups and variables of a NetCDF-4 file, one column per member. A group
+// holds a table with one object per row along its "rows" dimension, the state being the only
+// row of the root group. Numbers and strings become variables over the rows and objects become
+// subgroups. Vectors become CF contiguous ragged arrays, their lengths in "<name>_count" and
+// their elements along a sample dimension, or in a subgroup if they are objects or vectors.
+// Values of any other type are kept as JSON strings.
+class NetCDFState {
+ public:
+  NetCDFState(const std::filesystem::path&, const netCDF::NcFile::FileMode);
+
+  NetCDFState()                              = delete;
+  NetCDFState(NetCDFState&&)                 = delete;
+  NetCDFState(const NetCDFState&)            = delete;
+  NetCDFState& operator=(NetCDFState&&)      = delete;
+  NetCDFState& operator=(const NetCDFState&) = delete;
+
+  // Compressed variables are shuffled and deflated
+  template <typename T> requires HasMembers<T>
+  void write(const T& state, const std::uint8_t isCompressed = false) {
+    netCDF::NcGroup root = file_.getRoot();
+    writeMembers(root, root.addDim(consts::kStateRows, 1), std::vector<const T*>{&state},
+                 isCompressed);
+  }
+
+  template <typename T> requires HasMembers<T>
+  void read(T& state) {
+    readMembers(file_.getRoot(), std::vector<T*>{&state});
+  }
+
+ private:
+  // Appends the member at the given position in the object, if it is of type M
+  template <typename T, typename M>
+  static void getMember(T& object, const std::uint64_t index, std::vector<M*>& members) {
+    std::uint64_t position = 0;
+    object.forEachMember([&](const char*, auto& member) {
+      if constexpr (std::is_same_v<decltype(&member), M*>) {
+        if (position == index) {
+          members.push_back(&member);
+        }
+      }
+      ++position;
+    });
+  }
+
+  template <typename T>
+  void writeMembers(netCDF::NcGroup& group, const netCDF::NcDim& rows,
+                    const std::vector<const T*>& column, const std::uint8_t isCompressed) {
+    const T prototype{};  // Defines the columns of empty tables as well
+    std::uint64_t index = 0;
+    prototype.forEachMember([&](const char* name, const auto& member) {
+      std::vector<const std::decay_t<decltype(member)>*> members;
+      members.reserve(column.size());
+      for (const T* row : column) {
+        getMember(*row, index, members);
+      }
+      writeColumn(group, rows, name, members, isCompressed);
+      ++index;
+    });
+  }
+
+  template <typename T>
+  void writeColumn(netCDF::NcGroup& group, const netCDF::NcDim& rows, const std::string& name,
+                   const std::vector<const T*>& column, const std::uint8_t isCompressed) {
+    if constexpr (HasMembers<T>) {
+      netCDF::NcGroup subgroup = group.addGroup(name);
+      writeMembers(subgroup, subgroup.addDim(consts::kStateRows, column.size()), column,
+                   isCompressed);
+    } else if constexpr (IsNetCDFArray<T>) {
+      using E = typename T::value_type;
+      std::vector<NetCDFValue<std::uint64_t>::type> counts;
+      counts.reserve(column.size());
+      std::vector<const E*> elements;
+      for (const T* row : column) {
+        counts.push_back(row->size());
+        for (const E& element : *row) {
+          elements.push_back(&element);
+        }
+      }
+      writeValues(group, rows, name + consts::kCountSuffix, consts::eUInt64, counts,
+                  isCompressed).putAtt(consts::kSampleDimension, name);
+      if constexpr (HasMembers<E> || IsNetCDFArray<E>) {
+        netCDF::NcGroup subgroup = group.addGroup(name);
+        const netCDF::NcDim samples = subgroup.addDim(consts::kStateRows, elements.size());
+        if constexpr (HasMembers<E>) {
+          writeMembers(subgroup, samples, elements, isCompressed);
+        } else {
+          writeColumn(subgroup, samples, consts::kStateValues, elements, isCompressed);
+        }
+      } else {
+        writeColumn(group, group.addDim(name, elements.size()), name, elements, isCompressed);
+      }
+    } else if constexpr (IsNetCDFNumber<T>) {
+      std::vector<typename NetCDFValue<T>::type> values;
+      values.reserve(column.size());
+      for (const T* row : column) {
+        values.push_back(static_cast<typename NetCDFValue<T>::type>(*row));
+      }
+      writeValues(group, rows, name, NetCDFValue<T>::dataType, values, isCompressed);
+    } else {
+      std::vector<std::string> texts;
+      if constexpr (std::is_same_v<T, std::string> == false) {
+        texts.reserve(column.size());
+        for (const T* row : column) {
+          texts.push_back(nlohmann::json(*row).dump());
+        }
+      }
+      std::vector<const char*> values;
+      values.reserve(column.size());
+      for (std::uint64_t row = 0; row < column.size(); ++row) {
+        if constexpr (std::is_same_v<T, std::string>) {
+          values.push_back(column[row]->c_str());
+        } else {
+          values.push_back(texts[row].c_str());
+        }
+      }
+      writeValues(group, rows, name, consts::eString, values, isCompressed);
+    }
+  }
+
+  template <typename S>
+  netCDF::NcVar writeValues(netCDF::NcGroup& group, const netCDF::NcDim& rows,
+                            const std::string& name, const std::uint8_t dataType,
+                            std::vector<S>& values, const std::uint8_t isCompressed) {
+    netCDF::NcVar var = group.addVar(name, getType(dataType), rows);
+    if (isCompressed == true) {
+      var.setCompression(true, true, consts::kStateDeflateLevel);
+    }
+    if (values.empty() == false) {
+      var.putVar(values.data());
+    }
+    return var;
+  }
+
+  template <typename T>
+  void readMembers(const netCDF::NcGroup& group, const std::vector<T*>& column) {
+    if (column.empty() == true) {
+      return;
+    }
+    std::uint64_t index = 0;
+    column.front()->forEachMember([&](const char* name, auto& member) {
+      std::vector<std::decay_t<decltype(member)>*> members;
+      members.reserve(column.size());
+      for (T* row : column) {
+        getMember(*row, index, members);
+      }
+      readColumn(group, name, members);
+      ++index;
+    });
+  }
+
+  template <typename T>
+  void readColumn(const netCDF::NcGroup& group, const std::string& name,
+                  const std::vector<T*>& column) {
+    if constexpr (HasMembers<T>) {
+      readMembers(getGroup(group, name), column);
+    } else if constexpr (IsNetCDFArray<T>) {
+      using E = typename T::value_type;
+      std::vector<NetCDFValue<std::uint64_t>::type> counts(column.size());
+      readValues(group, name + consts::kCountSuffix, counts);
+      std::vector<E*> elements;
+      for (std::uint64_t row = 0; row < column.size(); ++row) {
+        column[row]->resize(counts[row]);
+        for (E& element : *column[row]) {
+          elements.push_back(&element);
+        }
+      }
+      if constexpr (HasMembers<E>) {
+        readMembers(getGroup(group, name), elements);
+      } else if constexpr (IsNetCDFArray<E>) {
+        readColumn(getGroup(group, name), consts::kStateValues, elements);
+      } else {
+        readColumn(group, name, elements);
+      }
+    } else if constexpr (IsNetCDFNumber<T>) {
+      std::vector<typename NetCDFValue<T>::type> values(column.size());
+      readValues(group, name, values);
+      for (std::uint64_t row = 0; row < column.size(); ++row) {
+        *column[row] = static_cast<T>(values[row]);
+      }
+    } else {
+      std::vector<char*> values(column.size());
+      readValues(group, name, values);
+      try {
+        for (std::uint64_t row = 0; row < column.size(); ++row) {
+          if constexpr (std::is_same_v<T, std::string>) {
+            column[row]->assign(values[row]);
+          } else {
+            nlohmann::json::parse(values[row]).get_to(*column[row]);
+          }
+        }
+      } catch (...) {
+        freeStrings(values);
+        throw;
+      }
+      freeStrings(values);
+    }
+  }
+
+  template <typename S>
+  void readValues(const netCDF::NcGroup& group, const std::string& name, std::vector<S>& values) {
+    const netCDF::NcVar var = getVar(group, name);
+    if (var.getDim(0).getSize() != values.size()) {
+      throw std::runtime_error("Variable \"" + name + "\" does not match the state.");
+    }
+    if (values.empty() == false) {
+      var.getVar(values.data());
+    }
+  }
+
+  static netCDF::NcType getType(const std::uint8_t);
+  static netCDF::NcGroup getGroup(const netCDF::NcGroup&, const std::string&);
+  static netCDF::NcVar getVar(const netCDF::NcGroup&, const std::string&);
+  static void freeStrings(std::vector<char*>&);
+
+  NetCDFFile file_;
+};
+}  // namespace jino
+
+#endif  // INCLUDE_NETCDFSTATE_H_
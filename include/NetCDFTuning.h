@@ -0,0 +1,44 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#ifndef INCLUDE_NETCDFTUNING_H_
+#define INCLUDE_NETCDFTUNING_H_
+
+#include <cstdint>
+
+#include "nlohmann/json.hpp"
+
+namespace jino {
+// Tuning profile for the files a NetCDFWriter creates, read by JsonReader::readTuning. Keys left
+// out of the JSON keep these defaults, and zero sizes or a negative preemption keep the settings
+// netCDF started with, whatever an earlier profile set. Alignment needs netCDF-C 4.9 or later.
+struct NetCDFTuning {
+  std::uint64_t cacheSize = 0;      // Bytes of HDF5 chunk cache per file, set process-wide
+  std::uint64_t cacheSlots = 0;     // Hash slots of the chunk cache
+  float cachePreemption = -1;       // Weight given to evicting fully read or written chunks
+  std::uint64_t varCacheSize = 0;   // Bytes of chunk cache given to each variable instead
+  std::int32_t alignThreshold = 0;  // Objects at least this large start on an alignment boundary
+  std::int32_t alignment = 0;
+  std::uint8_t isFilled = true;     // Pre-fill variables, unnecessary when all is overwritten
+
+  NLOHMANN_DEFINE_TYPE_INTRUSIVE_WITH_DEFAULT(NetCDFTuning, cacheSize, cacheSlots,
+                                              cachePreemption, varCacheSize, alignThreshold,
+                                              alignment, isFilled)
+};
+}  // namespace jino
+
+#endif  // INCLUDE_NETCDFTUNING_H_
@@ -18,22 +18,31 @@
 #ifndef INCLUDE_NETCDFWRITER_H_
 #define INCLUDE_NETCDFWRITER_H_
 
+#include <cstdint>
 #include <filesystem>
+#include <map>
 #include <memory>
 #include <string>
 
 #include "BufferBase.h"
+#include "BufferKey.h"
 #include "NetCDFData.h"
 #include "NetCDFFile.h"
+#include "NetCDFTuning.h"
 
 namespace jino {
 class Buffers;
 
 class NetCDFWriter {
  public:
-  NetCDFWriter(const std::string&);
+  explicit NetCDFWriter(const std::string&);
+  NetCDFWriter(const std::string&, Buffers&);
 
   void init();
+  void resume(const std::filesystem::path&);
+  void setFormat(const std::uint8_t);  // One of eFileFormats, for files opened from now on
+  void setDiskless(const std::uint64_t);  // Memory cap in bytes, zero for disk-backed files
+  void setTuning(const NetCDFTuning&);
 
   void writeMetadata(const NetCDFData&);
   void writeDatums(const NetCDFData&);
@@ -42,21 +51,36 @@ class NetCDFWriter {
 
   void closeFile();
 
+  std::filesystem::path getPath() const;
+
  private:
   void writeAttrs(const NetCDFData&);
   void writeDims(const NetCDFData&);
   void writeVars(const NetCDFData&);
+  void writeLabels();
 
   void writeGroupedDatum(const std::string&, const std::string&, NetCDFFile&, BufferBase* const);
   void writeUngroupedDatum(const std::string&, NetCDFFile&, BufferBase* const);
 
-  void writeGroupedData(const std::string&, const std::string&, NetCDFFile&, BufferBase* const);
-  void writeUngroupedData(const std::string&, NetCDFFile&, BufferBase* const);
+  void writeGroupedData(const std::string&, const std::string&, BufferBase* const);
+  void writeUngroupedData(const std::string&, BufferBase* const);
+
+  template <typename T>
+  void writeSlabs(const std::string&, const std::string&, BufferBase* const);
 
   NetCDFFile& getFile();
+  void checkMemory(const std::uint64_t = 0);
+  void resumeBuffer(const BufferKey&, BufferBase* const);
 
   const std::string& date_;
+  Buffers& buffers_;
   std::unique_ptr<NetCDFFile> file_;
+  std::filesystem::path path_;
+  std::uint8_t isResumed_;
+  std::map<BufferKey, const BufferBase*> resumed_;  // Buffers carried on from the resumed file
+  std::uint8_t format_;
+  std::uint64_t memoryCap_;
+  NetCDFTuning tuning_;
 };
 }  // namespace jino
 
@@ -18,20 +18,44 @@
 #ifndef INCLUDE_OUTPUTTHREAD_H_
 #define INCLUDE_OUTPUTTHREAD_H_
 
+#include <algorithm>
 #include <cstdint>
+#include <filesystem>
 #include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "nlohmann/json.hpp"
 
+#include "BlockGzip.h"
+#include "Buffers.h"
+#include "ChunkBuffer.h"
 #include "Constants.h"
+#include "NetCDFFile.h"
+#include "NetCDFState.h"
+#include "NetCDFTuning.h"
 #include "NetCDFWriter.h"
+#include "StateIndex.h"
+#include "StateMembers.h"
+#include "StateWriter.h"
 #include "ThreadQueues.h"
 
 namespace jino {
 class Output {
  public:
   Output();
+  explicit Output(Buffers&);
 
   const std::string& getDate() const;
 
@@ -40,38 +64,190 @@ class Output {
   void toFile(const NetCDFData&);
 
   void closeNetCDF();
+  void resumeNetCDF(const std::filesystem::path&);
+  void setNetCDFFormat(const std::uint8_t);
+  void setNetCDFDiskless(const std::uint64_t = consts::kDisklessMemoryCap);
+  void setNetCDFTuning(const NetCDFTuning&);
+  std::filesystem::path getNetCDFPath() const;
 
+  // Writes a checkpoint as indented JSON, CBOR, MessagePack or NetCDF-4 (see eStateFormats) and
+  // returns its path. The binary formats keep doubles exact and are read back by
+  // JsonReader::readState. Compressed checkpoints gain a ".gz" extension and are deflated in
+  // parallel blocks, NetCDF ones deflate their variables instead. Indexed JSON of reflected types
+  // also gets a sidecar StateIndex, which JsonReader::readStateParts uses to go straight to the
+  // values asked for.
   template <typename T>
-  void writeState(const T& system) {
-    nlohmann::json j = system;
-    std::filesystem::path path(consts::kOutputDir + date_ + consts::kJSONExtension);
+  std::filesystem::path writeState(const T& system, const std::uint8_t format = consts::eJSON,
+                                   const std::uint8_t isCompressed = false,
+                                   const std::uint8_t isIndexed = false) {
+    std::filesystem::path path;
     try {
-      std::uint32_t count = 1;
-      while (std::filesystem::exists(path) == true) {
-        path = consts::kOutputDir + date_ + "(" + std::to_string(count) + ")" + consts::kJSONExtension;
-        ++count;
+      path = reserveStatePath(format, isCompressed);
+      writeStateFile(path, system, format, isCompressed, isIndexed);
+    } catch (const std::exception& error) {
+      std::cout << "ERROR: Could not open file \"" << path << "\"..."<< std::endl;
+      std::cerr << error.what() << std::endl;
+    }
+    return path;
+  }
+
+  // Takes a snapshot of the state (a copy, or a move for rvalues) and writes it on the JSON
+  // output thread, or for NetCDF on the NetCDF one, while the caller carries on. Checkpoints
+  // are written in the order requested and the future yields the path once the file is
+  // complete, or rethrows why it could not be.
+  template <typename T>
+  std::future<std::filesystem::path> writeStateAsync(T&& system,
+                                                     const std::uint8_t format = consts::eJSON) {
+    auto snapshot = std::make_shared<const std::decay_t<T>>(std::forward<T>(system));
+    auto task = std::make_shared<std::packaged_task<std::filesystem::path()>>(
+        [this, snapshot, format]() {
+      const std::filesystem::path path = reserveStatePath(format, false);
+      writeStateFile(path, *snapshot, format, false, false);
+      return path;
+    });
+    std::future<std::filesystem::path> future = task->get_future();
+    // NetCDF checkpoints queue behind the NetCDF writer rather than racing it in the library
+    const std::uint8_t thread = format == consts::eNetCDF ? consts::eNetCDFThread :
+                                                            consts::eJSONThread;
+    threads_.enqueue(thread, [task]() {
+      (*task)();
+    });
+    return future;
+  }
+
+  // Writes the full state on the first and every baseInterval-th call, and otherwise a JSON
+  // Patch (RFC 6902) against the previous checkpoint, which it names. JsonReader::readState
+  // rebuilds the state from a delta by replaying the chain back to its full checkpoint. Between
+  // calls the previous state is only held as CBOR. A failed write returns an empty path and the
+  // next delta is taken against the last checkpoint that was written.
+  template <typename T>
+  std::filesystem::path writeStateDelta(const T& system,
+                                        const std::uint64_t baseInterval =
+                                            consts::kDeltaBaseInterval) {
+    const std::uint64_t interval = std::max<std::uint64_t>(baseInterval, 1);
+    std::filesystem::path path;
+    try {
+      const std::uint8_t isBase = checkpointCount_ % interval == 0;
+      const std::uint8_t isNextBase = (checkpointCount_ + 1) % interval == 0;
+      nlohmann::json state;
+      if (isBase == false || isNextBase == false) {
+        state = system;
+      }
+      if (isBase == true) {
+        path = reserveStatePath(consts::eJSON, false);
+        writeStateFile(path, system, consts::eJSON, false, false);
+      } else {
+        path = reservePath(consts::kDeltaExtension);
+        writePatch(path, nlohmann::json::diff(nlohmann::json::from_cbor(lastState_), state));
       }
-      std::ofstream file(path);
-      if (file.is_open()) {
-        file << std::setprecision(std::numeric_limits<double>::digits10 + 1);
-        file << j.dump(consts::kJsonIndentSize);  // Indented output
-        file.close();
+      if (isNextBase == false) {
+        lastState_ = nlohmann::json::to_cbor(state);
+      } else {
+        lastState_.clear();
       }
     } catch (const std::exception& error) {
-      std::cout << "ERROR: Could not open file \"" << path << "\"..."<< std::endl;
+      std::cout << "ERROR: Could not write checkpoint \"" << path << "\"..."<< std::endl;
       std::cerr << error.what() << std::endl;
+      return std::filesystem::path();
     }
+    lastPath_ = path;
+    ++checkpointCount_;
+    return path;
   }
 
   void waitForCompletion();
 
  private:
   void initOutDir() const;
+  std::filesystem::path reservePath(const std::string&) const;
+  std::filesystem::path reserveStatePath(const std::uint8_t, const std::uint8_t) const;
+  void writePatch(const std::filesystem::path&, const nlohmann::json&) const;
+
+  // Throws on any failure, writeState reports it and writeStateAsync passes it to the future
+  template <typename T>
+  void writeStateFile(const std::filesystem::path& path, const T& system,
+                      const std::uint8_t format, const std::uint8_t isCompressed,
+                      const std::uint8_t isIndexed) {
+    if (format == consts::eNetCDF) {
+      writeNetCDF(path, system, isCompressed);
+      return;
+    }
+    StateIndex index;
+    std::ofstream file;
+    file.rdbuf()->pubsetbuf(nullptr, 0);  // Output arrives in whole chunks
+    file.open(path, std::ios::binary);
+    if (file.is_open() == false) {
+      throw std::runtime_error("Could not open state file.");
+    }
+    auto toFile = [&file](const std::string_view chunk) {
+      if (file.write(chunk.data(), chunk.size()).fail() == true) {
+        throw std::runtime_error("Could not write state chunk.");
+      }
+    };
+    if (isCompressed == true) {
+      BlockGzip gzip(toFile);
+      ChunkBuffer buffer(consts::kStateChunkSize, [&gzip](const std::string_view chunk) {
+        gzip.write(chunk);
+      });
+      writeChunks(buffer, system, format, isIndexed == true ? &index : nullptr);
+      gzip.finish();
+    } else {
+      ChunkBuffer buffer(consts::kStateChunkSize, toFile);
+      writeChunks(buffer, system, format, isIndexed == true ? &index : nullptr);
+    }
+    file.close();
+    if (index.isEmpty() == false) {
+      index.write(path);
+    }
+  }
+
+  template <typename T>
+  void writeNetCDF(const std::filesystem::path& path, const T& system,
+                   const std::uint8_t isCompressed) {
+    if constexpr (HasMembers<T>) {
+      std::lock_guard<std::recursive_mutex> lock(NetCDFFile::getMutex());
+      NetCDFState state(path, netCDF::NcFile::replace);
+      state.write(system, isCompressed);
+    } else {
+      throw std::invalid_argument("NetCDF state needs a type declared with "
+                                  "JINO_DEFINE_TYPE_INTRUSIVE.");
+    }
+  }
+
+  // Reflected types are streamed as JSON without an intermediate document, anything else and
+  // the binary formats are serialised from a nlohmann::json.
+  template <typename T>
+  void writeChunks(ChunkBuffer& buffer, const T& system, const std::uint8_t format,
+                   StateIndex* const index) {
+    if constexpr (HasMembers<T>) {
+      if (format == consts::eJSON) {
+        StateWriter writer(buffer, consts::kJsonIndentSize, index);
+        writer.write(system);
+        writer.finish();
+        return;
+      }
+    }
+    nlohmann::json j = system;
+    std::ostream stream(&buffer);
+    stream.exceptions(std::ios::badbit);  // Passes on failures of the sink
+    if (format == consts::eCBOR) {
+      nlohmann::json::to_cbor(j, stream);
+    } else if (format == consts::eMessagePack) {
+      nlohmann::json::to_msgpack(j, stream);
+    } else {
+      stream << j.dump(consts::kJsonIndentSize);  // Indented output
+    }
+    stream.flush();
+  }
 
   const std::string date_;
 
   ThreadQueues threads_;
   NetCDFWriter writer_;
+
+  std::vector<std::uint8_t> lastState_;  // CBOR of the state the next delta is taken against
+  std::filesystem::path lastPath_;
+  std::uint64_t checkpointCount_;
 };
 }  // namespace jino
 
@@ -0,0 +1,88 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#ifndef INCLUDE_PARALLELWRITER_H_
+#define INCLUDE_PARALLELWRITER_H_
+
+#include <mpi.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "BufferBase.h"
+#include "NetCDFData.h"
+
+namespace jino {
+class Buffers;
+
+// Writes the buffers of every rank in a communicator to one shared NetCDF-4 file through MPI-IO.
+// Each rank's buffers hold its subdomain of a single decomposed dimension, which follows the
+// subdomains of lower ranks and spans any gaps its partitions leave. All calls are collective, so
+// every rank makes them in the same order and with the same buffers attached. Only built with
+// the JINO_USE_MPI option.
+class ParallelWriter {
+ public:
+  ParallelWriter(const std::string&, MPI_Comm);
+  ParallelWriter(const std::string&, Buffers&, MPI_Comm);
+
+  ~ParallelWriter();
+
+  ParallelWriter()                                 = delete;
+  ParallelWriter(ParallelWriter&&)                 = delete;
+  ParallelWriter(const ParallelWriter&)            = delete;
+  ParallelWriter& operator=(ParallelWriter&&)      = delete;
+  ParallelWriter& operator=(const ParallelWriter&) = delete;
+
+  void init();
+
+  void toFile(const NetCDFData&, const std::string&);
+
+  void closeFile();
+
+  const std::filesystem::path& getPath() const;
+  std::uint64_t getOffset() const;  // First index of this rank's subdomain
+
+ private:
+  void decompose();
+  std::uint8_t isAnyFailed(const std::uint8_t) const;
+  void writeAttrs(const NetCDFData&);
+  void writeVars(const std::string&);
+  void writeData();
+
+  template <typename T>
+  void writeSlab(const std::int32_t, const std::int32_t, BufferBase* const);
+
+  std::int32_t getGroupId(const std::string&);
+
+  const std::string date_;
+  Buffers& buffers_;
+  MPI_Comm comm_;
+  std::int32_t rank_;
+  std::filesystem::path path_;
+  std::int32_t fileId_;
+  std::uint8_t isOpen_;
+  std::uint64_t count_;
+  std::uint64_t offset_;
+  std::uint64_t total_;
+  std::vector<std::int32_t> groupIds_;  // Per attached buffer, in registry order
+  std::vector<std::int32_t> varIds_;
+};
+}  // namespace jino
+
+#endif  // INCLUDE_PARALLELWRITER_H_
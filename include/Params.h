@@ -0,0 +1,62 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#ifndef INCLUDE_PARAMS_H_
+#define INCLUDE_PARAMS_H_
+
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+#include "Constants.h"
+#include "Types.h"
+
+namespace jino {
+// Type of each parameter, as declared by consts::kParamTypes
+template <std::uint8_t Param>
+using ParamType = typename DataType<consts::kParamTypes[Param]>::type;
+
+// Parameters held as one typed field each in eParams order, so that get<consts::eYMin>() is
+// resolved at compile time and costs no more than reading a member.
+class Params {
+ public:
+  Params() = default;
+
+  template <std::uint8_t Param>
+  const ParamType<Param>& get() const {
+    return std::get<Param>(values_);
+  }
+
+  template <std::uint8_t Param>
+  void set(ParamType<Param> value) {
+    std::get<Param>(values_) = std::move(value);
+  }
+
+ private:
+  template <typename>
+  struct Values;
+
+  template <std::size_t... Ids>
+  struct Values<std::index_sequence<Ids...>> {
+    using type = std::tuple<ParamType<Ids>...>;
+  };
+
+  typename Values<std::make_index_sequence<consts::eNumberOfParams>>::type values_;
+};
+}  // namespace jino
+
+#endif  // INCLUDE_PARAMS_H_
@@ -0,0 +1,54 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#ifndef INCLUDE_STATEINDEX_H_
+#define INCLUDE_STATEINDEX_H_
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace jino {
+// Byte offsets into JSON state of the values of its top-level members and of the elements of
+// those members that are arrays. Kept in a CBOR sidecar next to the state file, so that single
+// values can be found without scanning everything written before them.
+class StateIndex {
+ public:
+  StateIndex() = default;
+
+  static std::filesystem::path getPath(const std::filesystem::path&);
+
+  void addMember(const std::string&, const std::uint64_t);
+  std::vector<std::uint64_t>& getElements(const std::string&);
+
+  std::uint8_t isEmpty() const;
+  std::uint64_t seek(std::string_view&) const;
+
+  std::uint8_t read(const std::filesystem::path&);
+  void write(const std::filesystem::path&) const;
+
+ private:
+  std::map<std::string, std::uint64_t, std::less<>> members_;
+  std::map<std::string, std::vector<std::uint64_t>, std::less<>> elements_;
+};
+}  // namespace jino
+
+#endif  // INCLUDE_STATEINDEX_H_
@@ -0,0 +1,54 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#ifndef INCLUDE_STATEMEMBERS_H_
+#define INCLUDE_STATEMEMBERS_H_
+
+#include <type_traits>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#define JINO_VISIT_MEMBER(member) visitor(#member, member);
+
+// Drop-in replacement for NLOHMANN_DEFINE_TYPE_INTRUSIVE that additionally lets Jino visit the
+// members by name, so state can be read and written without an intermediate JSON document.
+#define JINO_DEFINE_TYPE_INTRUSIVE(Type, ...)                                 \
+  NLOHMANN_DEFINE_TYPE_INTRUSIVE(Type, __VA_ARGS__)                           \
+  template <typename Visitor>                                                 \
+  void forEachMember(Visitor&& visitor) {                                     \
+    NLOHMANN_JSON_EXPAND(NLOHMANN_JSON_PASTE(JINO_VISIT_MEMBER, __VA_ARGS__)) \
+  }                                                                           \
+  template <typename Visitor>                                                 \
+  void forEachMember(Visitor&& visitor) const {                               \
+    NLOHMANN_JSON_EXPAND(NLOHMANN_JSON_PASTE(JINO_VISIT_MEMBER, __VA_ARGS__)) \
+  }
+
+namespace jino {
+template <typename T>
+concept HasMembers = requires(T& value) {
+  value.forEachMember([](const char*, auto&) {});
+};
+
+template <typename T>
+struct IsVector : std::false_type {};
+
+template <typename T, typename A>
+struct IsVector<std::vector<T, A>> : std::true_type {};
+}  // namespace jino
+
+#endif  // INCLUDE_STATEMEMBERS_H_
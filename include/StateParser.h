@@ -0,0 +1,152 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#ifndef INCLUDE_STATEPARSER_H_
+#define INCLUDE_STATEPARSER_H_
+
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <type_traits>
+
+#include "nlohmann/json.hpp"
+
+#include "StateMembers.h"
+
+namespace jino {
+// Pull parser that deserialises JSON text straight into the target objects. Types declared with
+// JINO_DEFINE_TYPE_INTRUSIVE and vectors are filled member by member, only values of any other
+// type are parsed into a (small) nlohmann::json first. As with nlohmann's from_json, unknown keys
+// are ignored and a missing member throws.
+class StateParser {
+ public:
+  explicit StateParser(std::streambuf&);
+
+  StateParser() = delete;
+
+  template <typename T>
+  void read(T& value) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      readString(value);
+    } else if constexpr (std::is_same_v<T, bool>) {
+      value = readBool();
+    } else if constexpr (std::is_arithmetic_v<T>) {
+      readNumber(value);
+    } else if constexpr (IsVector<T>::value) {
+      value.clear();
+      expect('[');
+      if (isEmpty(']') == false) {
+        do {
+          read(value.emplace_back());
+        } while (hasNext(']') == true);
+      }
+    } else if constexpr (HasMembers<T>) {
+      std::string key;
+      std::uint64_t isRead = 0;  // One bit per member, the macros take at most 64
+      expect('{');
+      if (isEmpty('}') == false) {
+        do {
+          readString(key);
+          expect(':');
+          std::uint8_t isFound = false;
+          std::uint64_t bit = 1;
+          value.forEachMember([this, &key, &isFound, &isRead, &bit](const char* name,
+                                                                  auto& member) {
+            if (isFound == false && key == name) {
+              isFound = true;
+              isRead |= bit;
+              read(member);
+            }
+            bit <<= 1;
+          });
+          if (isFound == false) {
+            skipValue();
+          }
+        } while (hasNext('}') == true);
+      }
+      std::uint64_t bit = 1;
+      value.forEachMember([&isRead, &bit](const char* name, auto&) {
+        if ((isRead & bit) == 0) {
+          throw std::out_of_range("Key \"" + std::string(name) + "\" not found.");
+        }
+        bit <<= 1;
+      });
+    } else {
+      nlohmann::json j;
+      readJson(j);
+      j.get_to(value);
+    }
+  }
+
+  void finish();
+
+ private:
+  template <typename T>
+  void readNumber(T& value) {
+    readToken();
+    parseNumber(value);
+  }
+
+  template <typename T>
+  void parseNumber(T& value) {
+    if constexpr (std::is_floating_point_v<T>) {
+      if (token_ == kNull) {  // Non-finite values are serialised as null
+        value = std::numeric_limits<T>::quiet_NaN();
+        return;
+      }
+    }
+    const char* end = token_.data() + token_.size();
+    std::from_chars_result result = std::from_chars(token_.data(), end, value);
+    if constexpr (std::is_integral_v<T>) {
+      if (result.ec == std::errc() && result.ptr != end) {  // Fractional or exponent notation
+        double real = 0;
+        result = std::from_chars(token_.data(), end, real);
+        value = static_cast<T>(real);
+      }
+    }
+    if (result.ec != std::errc() || result.ptr != end) {
+      throw std::runtime_error("Invalid number \"" + token_ + "\" at offset " +
+                               std::to_string(offset_) + ".");
+    }
+  }
+
+  int peek();
+  char get();
+  void expect(const char);
+  std::uint8_t isEmpty(const char);
+  std::uint8_t hasNext(const char);
+
+  void readString(std::string&);
+  void readToken();
+  bool readBool();
+  void readJson(nlohmann::json&);
+  void skipValue();
+
+  [[noreturn]] void fail(const int);
+
+  static constexpr const char* kNull = "null";
+
+  std::streambuf& input_;
+  std::uint64_t offset_;
+  std::string token_;
+};
+}  // namespace jino
+
+#endif  // INCLUDE_STATEPARSER_H_
@@ -0,0 +1,154 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#ifndef INCLUDE_STATEWRITER_H_
+#define INCLUDE_STATEWRITER_H_
+
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "Constants.h"
+#include "StateIndex.h"
+#include "StateMembers.h"
+
+namespace jino {
+// Serialises objects as indented JSON straight into a stream buffer, the counterpart of
+// StateParser. Types declared with JINO_DEFINE_TYPE_INTRUSIVE are written member by member in
+// declaration order, only values of any other type go through a (small) nlohmann::json. Given
+// an index, the offsets of the top-level members and their array elements are recorded in it.
+class StateWriter {
+ public:
+  explicit StateWriter(std::streambuf&, const std::uint64_t = consts::kJsonIndentSize,
+                       StateIndex* const = nullptr);
+
+  StateWriter() = delete;
+
+  template <typename T>
+  void write(const T& value) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      writeString(value);
+    } else if constexpr (std::is_same_v<T, bool>) {
+      put(value == true ? "true" : "false");
+    } else if constexpr (std::is_arithmetic_v<T>) {
+      writeNumber(value);
+    } else if constexpr (IsVector<T>::value) {
+      writeElements(value, nullptr);
+    } else if constexpr (HasMembers<T>) {
+      const std::uint8_t isIndexed = index_ != nullptr && depth_ == 0;
+      std::uint8_t isFirst = true;
+      put('{');
+      ++depth_;
+      value.forEachMember([this, &isFirst, isIndexed](const char* name, const auto& member) {
+        put(isFirst == true ? "\n" : ",\n");
+        indent();
+        writeString(name);
+        put(": ");
+        if (isIndexed == true) {
+          index_->addMember(name, count_);
+        }
+        if constexpr (IsVector<std::decay_t<decltype(member)>>::value) {
+          writeElements(member, isIndexed == true ? &index_->getElements(name) : nullptr);
+        } else {
+          write(member);
+        }
+        isFirst = false;
+      });
+      --depth_;
+      if (isFirst == false) {
+        put('\n');
+        indent();
+      }
+      put('}');
+    } else {
+      writeJson(value);
+    }
+  }
+
+  void finish();
+
+ private:
+  // Offsets, when given, receive the position of each element
+  template <typename T, typename A>
+  void writeElements(const std::vector<T, A>& elements, std::vector<std::uint64_t>* offsets) {
+    if (elements.empty() == true) {
+      put("[]");
+      return;
+    }
+    if (offsets != nullptr) {
+      offsets->reserve(elements.size());
+    }
+    put('[');
+    ++depth_;
+    for (std::uint64_t i = 0; i < elements.size(); ++i) {
+      put(i == 0 ? "\n" : ",\n");
+      indent();
+      if (offsets != nullptr) {
+        offsets->push_back(count_);
+      }
+      write(elements[i]);
+    }
+    --depth_;
+    put('\n');
+    indent();
+    put(']');
+  }
+
+  template <typename T>
+  void writeNumber(const T value) {
+    if constexpr (std::is_floating_point_v<T>) {
+      if (std::isfinite(value) == false) {  // As nlohmann::json, which StateParser reads as NaN
+        put("null");
+        return;
+      }
+    }
+    char text[kNumberSize];
+    const std::to_chars_result result = std::to_chars(text, text + kNumberSize, value);
+    std::string_view number(text, result.ptr - text);
+    put(number);
+    if constexpr (std::is_floating_point_v<T>) {
+      if (number.find_first_of(".e") == std::string_view::npos) {
+        put(".0");  // Keeps the value a float when read back
+      }
+    }
+  }
+
+  void put(const char);
+  void put(const std::string_view);
+  void indent();
+
+  void writeString(const std::string_view);
+  void writeJson(const nlohmann::json&);
+
+  static constexpr std::uint64_t kNumberSize = 32;
+
+  std::streambuf& output_;
+  const std::uint64_t indentSize_;
+  StateIndex* const index_;
+  std::uint64_t depth_;
+  std::uint64_t count_;
+};
+}  // namespace jino
+
+#endif  // INCLUDE_STATEWRITER_H_
@@ -39,7 +39,6 @@ public:
       taskQueues_[queueId].emplace(std::forward<F>(f));
       if (activeThreads_.find(queueId) == activeThreads_.end()) {
         activeThreads_[queueId] = std::thread(&ThreadQueues::workerThread, this, queueId);
-        joinedThreads_[queueId] = false;
       }
     }
     condition_.notify_all();
@@ -55,7 +54,6 @@ private:
   std::map<std::uint64_t, std::queue<std::function<void()>>> taskQueues_;
   std::map<std::uint64_t, std::thread> activeThreads_;
   std::map<std::uint64_t, std::uint8_t> stopFlags_;
-  std::map<std::uint64_t, std::uint8_t> joinedThreads_;
   std::mutex queueMutex_;
   std::condition_variable condition_;
   std::uint8_t stopAll_ = false;
@@ -81,6 +81,65 @@ template <>
 struct Types<std::string> {
   static constexpr std::uint8_t type = consts::eString;
 };
+
+// The inverse of Types, from an eDataTypes value to its type
+template <std::uint8_t Type>
+struct DataType;
+
+template <>
+struct DataType<consts::eInt8> {
+  using type = std::int8_t;
+};
+
+template <>
+struct DataType<consts::eInt16> {
+  using type = std::int16_t;
+};
+
+template <>
+struct DataType<consts::eInt32> {
+  using type = std::int32_t;
+};
+
+template <>
+struct DataType<consts::eInt64> {
+  using type = std::int64_t;
+};
+
+template <>
+struct DataType<consts::eUInt8> {
+  using type = std::uint8_t;
+};
+
+template <>
+struct DataType<consts::eUInt16> {
+  using type = std::uint16_t;
+};
+
+template <>
+struct DataType<consts::eUInt32> {
+  using type = std::uint32_t;
+};
+
+template <>
+struct DataType<consts::eUInt64> {
+  using type = std::uint64_t;
+};
+
+template <>
+struct DataType<consts::eFloat> {
+  using type = float;
+};
+
+template <>
+struct DataType<consts::eDouble> {
+  using type = double;
+};
+
+template <>
+struct DataType<consts::eString> {
+  using type = std::string;
+};
 }  // namespace jino
 
 #endif // INCLUDE_TYPES_H_
@@ -15,39 +15,21 @@
 * If not, see <https://www.gnu.org/licenses/>.                                                *
 **********************************************************************************************/
 
-#ifndef INCLUDE_DATUM_H_
-#define INCLUDE_DATUM_H_
+#ifndef INCLUDE_VIEWBUFFER_H_
+#define INCLUDE_VIEWBUFFER_H_
 
-#include <string>
-
-#include "DatumBase.h"
+#include <streambuf>
+#include <string_view>
 
 namespace jino {
-template<class T>
-class Datum : public DatumBase {
- public:
-  explicit Datum(const T);
-  virtual ~Datum() = default;
-
-  Datum() = delete;
-
-  const T getValue() const {
-    return value_;
-  }
-
-  T getValue() {
-    return value_;
+// Read-only stream buffer over memory owned elsewhere, e.g. a MappedFile, so that stream based
+// parsers can consume it without a copy.
+struct ViewBuffer : public std::streambuf {
+  explicit ViewBuffer(const std::string_view view) {
+    char* begin = const_cast<char*>(view.data());
+    setg(begin, begin, begin + view.size());
   }
-
-  const std::string getValueStr() const;
-
-  void setValue(const T value) {
-    value_ = value;
-  }
-
- private:
-  T value_;
 };
 }  // namespace jino
 
-#endif   // INCLUDE_DATUM_H_
+#endif  // INCLUDE_VIEWBUFFER_H_
@@ -0,0 +1,224 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include "BlockGzip.h"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+// ID1, ID2, CM (deflate), FLG (FEXTRA), MTIME (4), XFL, OS (unknown), XLEN (2)
+constexpr unsigned char kHeader[] = {0x1f, 0x8b, 8, 4, 0, 0, 0, 0, 0, 0xff, 8, 0};
+constexpr std::uint64_t kHeaderSize = sizeof(kHeader);
+constexpr std::uint64_t kExtraSize = 8;    // SI1, SI2, LEN (2), member size (4)
+constexpr std::uint64_t kTrailerSize = 8;  // CRC32 (4), ISIZE (4)
+
+void putUInt32(std::string& bytes, const std::uint64_t offset, const std::uint32_t value) {
+  for (std::uint64_t i = 0; i < 4; ++i) {
+    bytes[offset + i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+  }
+}
+
+std::uint32_t getUInt32(const std::string_view bytes, const std::uint64_t offset) {
+  std::uint32_t value = 0;
+  for (std::uint64_t i = 0; i < 4; ++i) {
+    value |= static_cast<std::uint32_t>(static_cast<unsigned char>(bytes[offset + i])) << (8 * i);
+  }
+  return value;
+}
+
+std::uint32_t getUInt16(const std::string_view bytes, const std::uint64_t offset) {
+  return static_cast<unsigned char>(bytes[offset]) |
+         static_cast<std::uint32_t>(static_cast<unsigned char>(bytes[offset + 1])) << 8;
+}
+
+struct Member {
+  std::uint64_t begin;   // First byte of the deflate stream
+  std::uint64_t end;     // First byte of the trailer
+  std::uint64_t offset;  // Position of the inflated bytes in the output
+};
+
+// Locates the members of a block-compressed file, returning nothing if any lacks the JB field
+std::vector<Member> findMembers(const std::string_view bytes) {
+  std::vector<Member> members;
+  std::uint64_t offset = 0;
+  for (std::uint64_t pos = 0; pos < bytes.size();) {
+    if (bytes.size() - pos < kHeaderSize + kExtraSize + kTrailerSize ||
+        static_cast<unsigned char>(bytes[pos]) != kHeader[0] ||
+        static_cast<unsigned char>(bytes[pos + 1]) != kHeader[1] ||
+        (static_cast<unsigned char>(bytes[pos + 3]) & kHeader[3]) == 0 ||
+        getUInt16(bytes, pos + 10) != kExtraSize || bytes[pos + 12] != 'J' ||
+        bytes[pos + 13] != 'B' || getUInt16(bytes, pos + 14) != 4) {
+      return {};
+    }
+    const std::uint64_t size = getUInt32(bytes, pos + 16);
+    if (size < kHeaderSize + kExtraSize + kTrailerSize || size > bytes.size() - pos) {
+      return {};
+    }
+    const std::uint64_t end = pos + size - kTrailerSize;
+    members.push_back({pos + kHeaderSize + kExtraSize, end, offset});
+    offset += getUInt32(bytes, end + 4);
+    pos += size;
+  }
+  return members;
+}
+
+void inflateMember(const std::string_view bytes, const Member& member, char* output,
+                   const std::uint64_t size) {
+  z_stream stream{};
+  if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {  // Raw deflate, the framing is parsed here
+    throw std::runtime_error("Could not initialise decompression.");
+  }
+  stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(bytes.data() + member.begin));
+  stream.avail_in = static_cast<uInt>(member.end - member.begin);
+  stream.next_out = reinterpret_cast<Bytef*>(output);
+  stream.avail_out = static_cast<uInt>(size);
+  const int status = inflate(&stream, Z_FINISH);
+  inflateEnd(&stream);
+  const std::uint32_t crc = crc32(0, reinterpret_cast<const Bytef*>(output), size);
+  if (status != Z_STREAM_END || stream.total_out != size ||
+      crc != getUInt32(bytes, member.end)) {
+    throw std::runtime_error("Corrupt compressed block at offset " +
+                             std::to_string(member.begin) + ".");
+  }
+}
+}  // anonymous namespace
+
+jino::BlockGzip::BlockGzip(std::function<void(std::string_view)> sink,
+                           const std::uint64_t numThreads) :
+                           sink_(std::move(sink)),
+                           numThreads_(std::max<std::uint64_t>(numThreads, 1)) {}
+
+void jino::BlockGzip::write(const std::string_view block) {
+  if (blocks_.size() >= numThreads_) {
+    writeNext();
+  }
+  blocks_.push_back(std::async(std::launch::async, compressBlock, std::string(block)));
+}
+
+void jino::BlockGzip::finish() {
+  while (blocks_.empty() == false) {
+    writeNext();
+  }
+}
+
+std::string jino::BlockGzip::decompress(const std::string_view bytes,
+                                        const std::uint64_t numThreads) {
+  const std::vector<Member> members = findMembers(bytes);
+  if (members.empty() == true) {
+    return inflateAll(bytes);
+  }
+  std::string text(members.back().offset + getUInt32(bytes, members.back().end + 4), '\0');
+  const std::uint64_t count = std::min<std::uint64_t>(std::max<std::uint64_t>(numThreads, 1),
+                                                      members.size());
+  std::vector<std::future<void>> workers;
+  for (std::uint64_t worker = 0; worker < count; ++worker) {
+    workers.push_back(std::async(std::launch::async, [&, worker]() {
+      for (std::uint64_t i = members.size() * worker / count;
+           i < members.size() * (worker + 1) / count; ++i) {
+        const std::uint64_t end = i + 1 < members.size() ? members[i + 1].offset : text.size();
+        inflateMember(bytes, members[i], text.data() + members[i].offset,
+                      end - members[i].offset);
+      }
+    }));
+  }
+  for (std::future<void>& worker : workers) {
+    worker.get();  // Rethrows the first failure
+  }
+  return text;
+}
+
+void jino::BlockGzip::writeNext() {
+  std::string member = blocks_.front().get();
+  blocks_.pop_front();
+  sink_(member);
+}
+
+std::string jino::BlockGzip::compressBlock(const std::string& block) {
+  z_stream stream{};
+  if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8,
+                   Z_DEFAULT_STRATEGY) != Z_OK) {
+    throw std::runtime_error("Could not initialise compression.");
+  }
+  const std::uint64_t bound = deflateBound(&stream, block.size());
+  std::string member(kHeaderSize + kExtraSize + bound + kTrailerSize, '\0');
+  std::copy(std::begin(kHeader), std::end(kHeader), member.begin());
+  member[12] = 'J';
+  member[13] = 'B';
+  member[14] = 4;
+  stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(block.data()));
+  stream.avail_in = static_cast<uInt>(block.size());
+  stream.next_out = reinterpret_cast<Bytef*>(member.data() + kHeaderSize + kExtraSize);
+  stream.avail_out = static_cast<uInt>(bound);
+  const int status = deflate(&stream, Z_FINISH);
+  deflateEnd(&stream);
+  if (status != Z_STREAM_END) {
+    throw std::runtime_error("Could not compress block.");
+  }
+  const std::uint64_t end = kHeaderSize + kExtraSize + stream.total_out;
+  member.resize(end + kTrailerSize);
+  putUInt32(member, 16, static_cast<std::uint32_t>(member.size()));
+  putUInt32(member, end, crc32(0, reinterpret_cast<const Bytef*>(block.data()), block.size()));
+  putUInt32(member, end + 4, static_cast<std::uint32_t>(block.size()));
+  return member;
+}
+
+// Any gzip file, including concatenated members without the JB field
+std::string jino::BlockGzip::inflateAll(const std::string_view bytes) {
+  z_stream stream{};
+  if (inflateInit2(&stream, 16 + MAX_WBITS) != Z_OK) {
+    throw std::runtime_error("Could not initialise decompression.");
+  }
+  std::string text;
+  std::vector<char> chunk(1 << 16);
+  std::uint64_t pos = 0;
+  int status = Z_OK;
+  while (stream.avail_in > 0 || pos < bytes.size() || status == Z_OK) {
+    if (stream.avail_in == 0 && pos < bytes.size()) {  // zlib counts input in 32 bits
+      const std::uint64_t size = std::min<std::uint64_t>(bytes.size() - pos, 1 << 30);
+      stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(bytes.data() + pos));
+      stream.avail_in = static_cast<uInt>(size);
+      pos += size;
+    }
+    stream.next_out = reinterpret_cast<Bytef*>(chunk.data());
+    stream.avail_out = static_cast<uInt>(chunk.size());
+    status = inflate(&stream, Z_NO_FLUSH);
+    if (status != Z_OK && status != Z_STREAM_END) {
+      inflateEnd(&stream);
+      throw std::runtime_error("Corrupt compressed data.");
+    }
+    text.append(chunk.data(), chunk.size() - stream.avail_out);
+    if (status == Z_STREAM_END) {
+      if (stream.avail_in == 0 && pos == bytes.size()) {
+        break;
+      }
+      inflateReset(&stream);  // Next member
+    }
+  }
+  inflateEnd(&stream);
+  return text;
+}
@@ -17,6 +17,7 @@
 
 #include "Buffer.h"
 
+#include <algorithm>
 #include <iostream>
 #include <stdexcept>
 #include <string>
@@ -27,34 +28,43 @@
 #include "Types.h"
 
 template <class T>
-jino::Buffer<T>::Buffer(const std::string& name, const std::string& group,
-                        const std::uint64_t size, const T& var) :
-                 BufferBase(name, group, Types<T>::type), data_(size), var_(var),
-                 readIndex_(0), writeIndex_(0) {
-  Buffers::get().attach(this);
+jino::Buffer<T>::Buffer(Buffers& buffers, const std::string& name, const std::string& group,
+                        const std::uint64_t size, const T& var, const std::uint8_t mode) :
+                 BufferBase(name, group, Types<T>::type), buffers_(buffers), var_(var),
+                 mode_(mode), capacity_(size), partitionSize_(0), readIndex_(0), writeIndex_(0) {
+  data_.reserve(capacity_);
+  buffers_.attach(this);
 }
 
 template <class T>
-jino::Buffer<T>::Buffer(const std::string& name, const std::uint64_t size, const T& var) :
-                 BufferBase(name, Types<T>::type), data_(size), var_(var),
-                 readIndex_(0), writeIndex_(0) {
-  Buffers::get().attach(this);
+jino::Buffer<T>::Buffer(Buffers& buffers, const std::string& name, const std::uint64_t size,
+                        const T& var, const std::uint8_t mode) :
+                 BufferBase(name, Types<T>::type), buffers_(buffers), var_(var), mode_(mode),
+                 capacity_(size), partitionSize_(0), readIndex_(0), writeIndex_(0) {
+  data_.reserve(capacity_);
+  buffers_.attach(this);
 }
 
+template <class T>
+jino::Buffer<T>::Buffer(const std::string& name, const std::string& group,
+                        const std::uint64_t size, const T& var, const std::uint8_t mode) :
+                 Buffer(Buffers::get(), name, group, size, var, mode) {}
+
+template <class T>
+jino::Buffer<T>::Buffer(const std::string& name, const std::uint64_t size, const T& var,
+                        const std::uint8_t mode) :
+                 Buffer(Buffers::get(), name, size, var, mode) {}
+
 template <class T>
 jino::Buffer<T>::Buffer(const char* name, const char* group,
-                 const std::uint64_t size, const T& var) :
-                 BufferBase(std::string(name), std::string(group), Types<T>::type), data_(size),
-                 var_(var), readIndex_(0), writeIndex_(0) {
-  Buffers::get().attach(this);
-}
+                 const std::uint64_t size, const T& var, const std::uint8_t mode) :
+                 Buffer(Buffers::get(), std::string(name), std::string(group), size, var,
+                        mode) {}
 
 template <class T>
-jino::Buffer<T>::Buffer(const char* name, const std::uint64_t size, const T& var) :
-                 BufferBase(std::string(name), Types<T>::type), data_(size), var_(var),
-                 readIndex_(0), writeIndex_(0) {
-  Buffers::get().attach(this);
-}
+jino::Buffer<T>::Buffer(const char* name, const std::uint64_t size, const T& var,
+                        const std::uint8_t mode) :
+                 Buffer(Buffers::get(), std::string(name), size, var, mode) {}
 
 template class jino::Buffer<std::int8_t>;
 template class jino::Buffer<std::int16_t>;
@@ -70,28 +80,55 @@ template class jino::Buffer<std::string>;
 
 template <class T>
 jino::Buffer<T>::~Buffer() {
-  Buffers::get().detach(this);
+  buffers_.detach(this);
   data_.clear();
 }
 
 template<class T> void jino::Buffer<T>::record() {
-  if (writeIndex_ >= data_.size()) {
-    throw std::out_of_range("WriteIndex out of range.");
+  if (partitions_.empty() == false) {
+    throw std::runtime_error("Buffer \"" + name_ + "\" is partitioned.");
+  }
+  if (writeIndex_ < capacity_) {
+    data_.push_back(var_);
+  } else {
+    data_.at(position(writeIndex_)) = var_;
   }
-  data_.at(writeIndex_) = var_;
   ++writeIndex_;
 }
 
 template<class T>
 void jino::Buffer<T>::print() {
-  for (std::uint64_t i = 0; i < data_.size(); ++i) {
-    std::cout << name_ << consts::kSeparator << data_.at(i) << std::endl;
-  }
+  forEachSlab([this](const std::uint64_t, const std::uint64_t count, const T* values) {
+    for (std::uint64_t i = 0; i < count; ++i) {
+      std::cout << name_ << consts::kSeparator << values[i] << std::endl;
+    }
+  });
 }
 
 template<class T>
 std::uint64_t jino::Buffer<T>::size() const {
-  return data_.size();
+  return capacity_;
+}
+
+template<class T>
+std::uint64_t jino::Buffer<T>::getCount() const {
+  std::uint64_t count = data_.size();
+  for (const auto& partition : partitions_) {
+    count += partition.data.size();
+  }
+  return count;
+}
+
+// Differs from the count only where a partly filled partition leaves a gap before a later one
+template<class T>
+std::uint64_t jino::Buffer<T>::getSpan() const {
+  std::uint64_t span = 0;
+  forEachSlab([&span](const std::uint64_t start, const std::uint64_t count, const T*) {
+    if (count != 0) {
+      span = std::max(span, start + count);
+    }
+  });
+  return span;
 }
 
 template<class T>
@@ -100,38 +137,108 @@ std::uint64_t jino::Buffer<T>::getReadIndex() const {
 }
 
 template<class T> T& jino::Buffer<T>::at(const std::uint64_t index) {
-  if (index >= data_.size()) {
-    throw std::out_of_range("Index out of range.");
-  }
-  return data_.at(index);
+  return const_cast<T&>(locate(index));
 }
 
 template<class T> const T& jino::Buffer<T>::at(const std::uint64_t index) const {
-  if (index >= data_.size()) {
-    throw std::out_of_range("Index out of range.");
-  }
-  return data_.at(index);
+  return locate(index);
 }
 
 template<class T> T& jino::Buffer<T>::setNext() {
-  if (writeIndex_ >= data_.size()) {
-    throw std::out_of_range("WriteIndex out of range.");
+  if (partitions_.empty() == false) {
+    throw std::runtime_error("Buffer \"" + name_ + "\" is partitioned.");
   }
-  std::uint64_t i = writeIndex_;
+  if (writeIndex_ < capacity_) {
+    ++writeIndex_;
+    return data_.emplace_back();
+  }
+  std::uint64_t i = position(writeIndex_);
   ++writeIndex_;
   return data_.at(i);
 }
 
 template<class T> const T& jino::Buffer<T>::getNext() {
-  if (readIndex_ >= data_.size() && readIndex_ <= writeIndex_) {
+  if (partitions_.empty() == false) {
+    throw std::runtime_error("Buffer \"" + name_ + "\" is partitioned.");
+  }
+  if (readIndex_ >= writeIndex_) {
     throw std::out_of_range("ReadIndex out of range.");
   }
-  std::uint64_t i = readIndex_;
+  if (writeIndex_ - readIndex_ > capacity_) {
+    throw std::out_of_range("Record at ReadIndex has been overwritten.");
+  }
+  std::uint64_t i = readIndex_ % capacity_;
   ++readIndex_;
   return data_.at(i);
 }
 
+template<class T> void jino::Buffer<T>::partition(const std::uint64_t numPartitions) {
+  if (mode_ == consts::eCircular || writeIndex_ != 0 || partitions_.empty() == false) {
+    throw std::runtime_error("Buffer \"" + name_ + "\" cannot be partitioned.");
+  }
+  if (numPartitions == 0 || capacity_ % numPartitions != 0) {
+    throw std::invalid_argument("Size must be divisible by the number of partitions.");
+  }
+  partitionSize_ = capacity_ / numPartitions;
+  partitions_.resize(numPartitions);
+  for (auto& partition : partitions_) {
+    partition.data.reserve(partitionSize_);
+  }
+  data_.shrink_to_fit();
+}
+
+template<class T> T& jino::Buffer<T>::setNext(const std::uint64_t partition) {
+  std::vector<T>& data = partitions_.at(partition).data;
+  if (data.size() >= partitionSize_) {
+    throw std::out_of_range("WriteIndex out of range.");
+  }
+  return data.emplace_back();
+}
+
 template<class T>
 const std::vector<T>& jino::Buffer<T>::getData() const {
   return data_;
 }
+
+template<class T>
+void jino::Buffer<T>::forEachSlab(const std::function<void(const std::uint64_t,
+                                  const std::uint64_t, const T*)>& callback) const {
+  if (partitions_.empty() == false) {
+    for (std::uint64_t p = 0; p < partitions_.size(); ++p) {
+      const std::vector<T>& data = partitions_[p].data;
+      callback(p * partitionSize_, data.size(), data.data());
+    }
+  } else if (writeIndex_ <= capacity_) {
+    callback(0, data_.size(), data_.data());
+  } else {
+    const std::uint64_t head = writeIndex_ % capacity_;
+    callback(0, capacity_ - head, data_.data() + head);
+    if (head != 0) {
+      callback(capacity_ - head, head, data_.data());
+    }
+  }
+}
+
+template<class T>
+std::uint64_t jino::Buffer<T>::position(const std::uint64_t index) const {
+  if (mode_ == consts::eCircular && capacity_ != 0) {
+    return index % capacity_;
+  }
+  throw std::out_of_range("WriteIndex out of range.");
+}
+
+template<class T>
+const T& jino::Buffer<T>::locate(const std::uint64_t index) const {
+  if (partitions_.empty() == true) {
+    if (index < data_.size()) {
+      return data_[index];
+    }
+  } else {
+    const std::uint64_t p = index / partitionSize_;
+    const std::uint64_t offset = index % partitionSize_;
+    if (p < partitions_.size() && offset < partitions_[p].data.size()) {
+      return partitions_[p].data[offset];
+    }
+  }
+  throw std::out_of_range("Index out of range.");
+}
@@ -18,13 +18,14 @@
 #include "BufferBase.h"
 
 #include <string>
+#include <vector>
 
 jino::BufferBase::BufferBase(const std::string& name, const std::string& group,
                              const std::uint8_t type) :
-                  name_(name), group_(group), type_(type) {}
+                  name_(name), group_(group), type_(type), offset_(0) {}
 
 jino::BufferBase::BufferBase(const std::string& name, const std::uint8_t type) :
-                  name_(name), group_(""), type_(type) {}
+                  name_(name), group_(""), type_(type), offset_(0) {}
 
 const std::string& jino::BufferBase::getName() const {
   return name_;
@@ -37,3 +38,18 @@ const std::string& jino::BufferBase::getGroup() const {
 const std::uint8_t& jino::BufferBase::getType() const {
   return type_;
 }
+
+const std::vector<std::string>& jino::BufferBase::getLabels() const {
+  static const std::vector<std::string> noLabels;
+  return noLabels;
+}
+
+void jino::BufferBase::setLabels(const std::vector<std::string>&) {}
+
+void jino::BufferBase::setOffset(const std::uint64_t offset) {
+  offset_ = offset;
+}
+
+std::uint64_t jino::BufferBase::getOffset() const {
+  return offset_;
+}
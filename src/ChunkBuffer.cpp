@@ -0,0 +1,61 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include "ChunkBuffer.h"
+
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+jino::ChunkBuffer::ChunkBuffer(const std::uint64_t chunkSize,
+                               std::function<void(std::string_view)> sink) :
+                               chunk_(chunkSize), sink_(std::move(sink)), count_(0) {
+  if (chunkSize == 0) {
+    throw std::invalid_argument("Chunk size must be greater than zero.");
+  }
+  setp(chunk_.data(), chunk_.data() + chunk_.size());
+}
+
+// Bytes written so far, including those still held in the current chunk
+std::uint64_t jino::ChunkBuffer::getCount() const {
+  return count_ + static_cast<std::uint64_t>(pptr() - pbase());
+}
+
+jino::ChunkBuffer::int_type jino::ChunkBuffer::overflow(int_type c) {
+  flushChunk();
+  if (traits_type::eq_int_type(c, traits_type::eof()) == false) {
+    *pptr() = traits_type::to_char_type(c);
+    pbump(1);
+  }
+  return traits_type::not_eof(c);
+}
+
+int jino::ChunkBuffer::sync() {
+  flushChunk();
+  return 0;
+}
+
+void jino::ChunkBuffer::flushChunk() {
+  const std::uint64_t size = static_cast<std::uint64_t>(pptr() - pbase());
+  if (size > 0) {
+    sink_(std::string_view(pbase(), size));
+    count_ += size;
+    setp(chunk_.data(), chunk_.data() + chunk_.size());
+  }
+}
@@ -17,25 +17,27 @@
 
 #include "Data.h"
 
-#include <memory>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
-#include "Datum.h"
-
-jino::DatumBase& jino::Data::operator[](const std::string& key) {
-  auto it = values_.find(key);
+jino::DataValue& jino::Data::operator[](const std::string& key) {
+  auto it = find(key);
   if (it != values_.end()) {
-    return *it->second.get();
+    return values_[it - values_.cbegin()].second;
   } else {
     throw std::out_of_range("Datum \"" + key + "\" not found.");
   }
 }
 
-const jino::DatumBase& jino::Data::operator[](const std::string& key) const {
-  auto it = values_.find(key);
+const jino::DataValue& jino::Data::operator[](const std::string& key) const {
+  auto it = find(key);
   if (it != values_.end()) {
-    return *it->second.get();
+    return it->second;
   } else {
     throw std::out_of_range("Datum \"" + key + "\" not found.");
   }
@@ -43,9 +45,9 @@ const jino::DatumBase& jino::Data::operator[](const std::string& key) const {
 
 template <typename T>
 void jino::Data::setValue(const std::string& key, const T value) {
-  auto it = values_.find(key);
-  if (it == values_.end()) {
-    values_.insert({key, std::make_unique<Datum<T>>(value)});
+  auto it = lowerBound(key);
+  if (it == values_.end() || it->first != key) {
+    values_.emplace(it, key, value);
   } else {
     throw std::out_of_range("Datum \"" + key + "\" alredy exists.");
   }
@@ -65,11 +67,11 @@ template void jino::Data::setValue<std::string>(const std::string&, const std::s
 
 template <typename T>
 T jino::Data::getValue(const std::string& key) const {
-  auto it = values_.find(key);
+  auto it = find(key);
   if (it != values_.end()) {
-    Datum<T>* datum = dynamic_cast<Datum<T>*>(it->second.get());
-    if (datum) {
-      return datum->getValue();
+    const T* value = std::get_if<T>(&it->second);
+    if (value) {
+      return *value;
     } else {
       throw std::runtime_error("Type mismatch or invalid cast.");
     }
@@ -91,9 +93,9 @@ template double jino::Data::getValue<double>(const std::string&) const;
 template std::string jino::Data::getValue<std::string>(const std::string&) const;
 
 void jino::Data::forEachDatum(const std::function<void(const std::string&,
-                              DatumBase* const)>& callback) const {
-  for (const auto& [name, datum] : values_) {
-    callback(name, datum.get());
+                              const DataValue&)>& callback) const {
+  for (const auto& [name, value] : values_) {
+    callback(name, value);
   }
 }
 
@@ -102,7 +104,7 @@ std::uint64_t jino::Data::size() const {
 }
 
 std::uint8_t jino::Data::contains(const std::string& key) const {
-  auto it = values_.find(key);
+  auto it = find(key);
   if (it != values_.end()) {
     return true;
   } else {
@@ -110,8 +112,12 @@ std::uint8_t jino::Data::contains(const std::string& key) const {
   }
 }
 
+void jino::Data::reserve(const std::uint64_t size) {
+  values_.reserve(size);
+}
+
 void jino::Data::erase(const std::string& key) {
-  auto it = values_.find(key);
+  auto it = find(key);
   if (it != values_.end()) {
     values_.erase(it);
   } else {
@@ -120,8 +126,24 @@ void jino::Data::erase(const std::string& key) {
 }
 
 void jino::Data::clear() {
-  for (auto& [key, valPtr] : values_) {
-    valPtr.reset();
-  }
   values_.clear();
 }
+
+// The entry with the given name, or the end if there is none
+std::vector<std::pair<std::string, jino::DataValue>>::const_iterator jino::Data::find(
+    const std::string& key) const {
+  auto it = lowerBound(key);
+  if (it != values_.cend() && it->first == key) {
+    return it;
+  }
+  return values_.cend();
+}
+
+// The first entry not named before the given name
+std::vector<std::pair<std::string, jino::DataValue>>::const_iterator jino::Data::lowerBound(
+    const std::string& key) const {
+  return std::lower_bound(values_.cbegin(), values_.cend(), key,
+                          [](const auto& datum, const std::string& name) {
+    return datum.first < name;
+  });
+}
@@ -0,0 +1,121 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include "DictBuffer.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Buffers.h"
+#include "Constants.h"
+
+namespace {
+// Blanks are written to flag_meanings as underscores, so labels differing only there are one
+std::uint8_t isSameLabel(const std::string& label, const std::string& other) {
+  return std::equal(label.begin(), label.end(), other.begin(), other.end(),
+                    [](const char lhs, const char rhs) {
+    return lhs == rhs || ((lhs == ' ' || lhs == '_') && (rhs == ' ' || rhs == '_'));
+  });
+}
+}  // namespace
+
+jino::DictBuffer::DictBuffer(Buffers& buffers, const std::string& name, const std::string& group,
+                             const std::uint64_t size, const std::string& label,
+                             const std::uint8_t mode) :
+                  Buffer<std::int8_t>(buffers, name, group, size, code_, mode), label_(label),
+                  code_(0) {}
+
+jino::DictBuffer::DictBuffer(Buffers& buffers, const std::string& name, const std::uint64_t size,
+                             const std::string& label, const std::uint8_t mode) :
+                  Buffer<std::int8_t>(buffers, name, size, code_, mode), label_(label),
+                  code_(0) {}
+
+jino::DictBuffer::DictBuffer(const std::string& name, const std::string& group,
+                             const std::uint64_t size, const std::string& label,
+                             const std::uint8_t mode) :
+                  DictBuffer(Buffers::get(), name, group, size, label, mode) {}
+
+jino::DictBuffer::DictBuffer(const std::string& name, const std::uint64_t size,
+                             const std::string& label, const std::uint8_t mode) :
+                  DictBuffer(Buffers::get(), name, size, label, mode) {}
+
+void jino::DictBuffer::record() {
+  code_ = encode(label_);
+  Buffer<std::int8_t>::record();
+}
+
+void jino::DictBuffer::print() {
+  forEachSlab([this](const std::uint64_t, const std::uint64_t count, const std::int8_t* codes) {
+    for (std::uint64_t i = 0; i < count; ++i) {
+      std::cout << name_ << consts::kSeparator << decode(codes[i]) << std::endl;
+    }
+  });
+}
+
+const std::vector<std::string>& jino::DictBuffer::getLabels() const {
+  return labels_;
+}
+
+// Codes already recorded keep their meaning, so the buffer's own labels must agree with as many
+// of the new ones as they overlap, whether or not their blanks came back as underscores
+void jino::DictBuffer::setLabels(const std::vector<std::string>& labels) {
+  if (labels.size() > static_cast<std::uint64_t>(std::numeric_limits<std::uint8_t>::max()) + 1) {
+    throw std::out_of_range("Buffer \"" + name_ + "\" has too many labels.");
+  }
+  for (std::uint64_t code = 0; code < std::min(labels.size(), labels_.size()); ++code) {
+    if (isSameLabel(labels[code], labels_[code]) == false) {
+      throw std::runtime_error("Labels of buffer \"" + name_ + "\" do not match.");
+    }
+  }
+  labels_.insert(labels_.end(), labels.begin() + std::min(labels.size(), labels_.size()),
+                 labels.end());
+}
+
+std::int8_t jino::DictBuffer::encode(const std::string& label) {
+  const std::uint64_t last = static_cast<std::uint8_t>(code_);  // Labels tend to repeat
+  if (last < labels_.size() && isSameLabel(labels_[last], label) == true) {
+    return code_;
+  }
+  for (std::uint64_t code = 0; code < labels_.size(); ++code) {
+    if (isSameLabel(labels_[code], label) == true) {
+      return static_cast<std::int8_t>(code);
+    }
+  }
+  if (labels_.size() > std::numeric_limits<std::uint8_t>::max()) {
+    throw std::out_of_range("Buffer \"" + name_ + "\" has too many labels.");
+  }
+  labels_.push_back(label);
+  return static_cast<std::int8_t>(labels_.size() - 1);
+}
+
+const std::string& jino::DictBuffer::decode(const std::int8_t code) const {
+  const std::uint64_t index = static_cast<std::uint8_t>(code);
+  if (index >= labels_.size()) {
+    throw std::out_of_range("Code out of range.");
+  }
+  return labels_[index];
+}
+
+void jino::DictBuffer::setNext(const std::string& label) {
+  std::int8_t code = encode(label);
+  Buffer<std::int8_t>::setNext() = code;
+}
@@ -17,21 +17,22 @@
 
 #include "JsonReader.h"
 
-#include <fstream>
+#include <filesystem>  /// NOLINT
 #include <iostream>
+#include <memory>
+#include <set>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
+#include "BlockGzip.h"
 #include "Constants.h"
+#include "MappedFile.h"
+#include "Params.h"
 
 namespace {
-std::streamsize getFileSize(const std::string& path) {
-  std::ifstream file(path, std::ios::binary | std::ios::ate);
-  if (!file) {
-    throw std::ios_base::failure("Could not open file.");
-  }
-  return file.tellg();
-}
-
 std::uint8_t strCompare(const std::string& str1, const std::string& str2) {
   return str1.size() == str2.size() && std::equal(str1.begin(), str1.end(), str2.begin(),
                                                   [](unsigned char c1, unsigned char c2) {
@@ -41,42 +42,49 @@ std::uint8_t strCompare(const std::string& str1, const std::string& str2) {
 }  // Anonymous namespace
 
 void jino::JsonReader::readText(const std::string& path, std::string& text) {
-  try {
-    std::ifstream fileIn(path);
-    fileIn.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-    if (!fileIn.is_open()) {
-      throw std::ios_base::failure("Could not open file.");
-    }
-    std::streamsize sz = getFileSize(path);
-    if (static_cast<std::uint64_t>(sz) <= consts::kMaxFileSizeInBytes) {
-      text.assign((std::istreambuf_iterator<char>(fileIn)), std::istreambuf_iterator<char>());
-    } else {
-      throw std::runtime_error("File is too large.");
+  text.assign(mapText(path)->view());
+}
+
+std::uint8_t jino::JsonReader::getStateFormat(const std::filesystem::path& path) {
+  const std::string extension = (isCompressed(path) ? path.stem() : path).extension().string();
+  for (std::uint8_t format = 0; format < consts::eNumberOfStateFormats; ++format) {
+    if (strCompare(extension, consts::kStateExtensions.at(format)) == true) {
+      return format;
     }
-    fileIn.close();
+  }
+  return consts::eJSON;
+}
+
+std::uint8_t jino::JsonReader::isCompressed(const std::filesystem::path& path) {
+  return strCompare(path.extension().string(), consts::kGzipExtension);
+}
+
+std::uint8_t jino::JsonReader::isDelta(const std::filesystem::path& path) {
+  return strCompare(path.extension().string(), consts::kDeltaExtension);
+}
+
+void jino::JsonReader::readParams(jino::Data& params) {
+  std::string path = consts::kInputDir + consts::kParamsFile;
+  std::unique_ptr<MappedFile> file = mapText(path);
+  try {
+    parseParams(file->view(), params);
   } catch (const std::exception& error) {
-    std::cout << "ERROR: Could not access file \"" << path << "\"..." << std::endl;
+    std::cout << "ERROR: Params file not formatted correctly..." << std::endl;
     std::cerr << error.what() << std::endl;
     std::exit(EXIT_FAILURE);
   }
 }
 
-void jino::JsonReader::readParams(jino::Data& params) {
-  std::string text;
+void jino::JsonReader::readParams(jino::Params& params) {
   std::string path = consts::kInputDir + consts::kParamsFile;
-  readText(path, text);
+  std::unique_ptr<MappedFile> file = mapText(path);
   try {
-    nlohmann::json jsonData = nlohmann::json::parse(text);  // Arranged alphabetically
+    std::string_view text = file->view();
+    nlohmann::json jsonData = nlohmann::json::parse(text.begin(), text.end());
     if (jsonData.is_object() && jsonData.size() == consts::kParamNames.size()) {
-      for (std::uint64_t i = 0; i < jsonData.size(); ++i) {
-        const std::string& paramName = consts::kParamNames.at(i);
-        const std::uint8_t paramType = consts::kParamTypes.at(i);
-        if (jsonData.contains(paramName)) {
-          setValue(params, paramName, paramType, jsonData[paramName]);
-        } else {
-          throw std::out_of_range("Required parameter \"" + paramName + "\" not found in file.");
-        }
-      }
+      [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        (setValue<Is>(params, jsonData), ...);
+      }(std::make_index_sequence<consts::eNumberOfParams>{});
     } else {
       throw std::runtime_error("Incorrect file format.");
     }
@@ -88,34 +96,125 @@ void jino::JsonReader::readParams(jino::Data& params) {
 }
 
 void jino::JsonReader::readAttrs(jino::Data& attrs) {
-  std::string text;
   std::string path = consts::kInputDir + consts::kAttrsFile;
-  readText(path, text);
+  std::unique_ptr<MappedFile> file = mapText(path);
+  try {
+    parseAttrs(file->view(), attrs);
+  } catch (const std::exception& error) {
+    std::cout << "ERROR: Input file not formatted correctly..." << std::endl;
+    std::cerr << error.what() << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+}
+
+// The profile is optional, without its file the writer keeps the netCDF defaults
+void jino::JsonReader::readTuning(jino::NetCDFTuning& tuning, const std::filesystem::path& path) {
+  if (std::filesystem::exists(path) == false) {
+    return;
+  }
+  std::unique_ptr<MappedFile> file = mapText(path);
   try {
-    nlohmann::json jsonData = nlohmann::json::parse(text);  // Arranged alphabetically
-    if (jsonData.is_object()) {
-      for (auto it = jsonData.begin(); it != jsonData.end(); ++it) {
-        const std::string& key = it.key();
-        const auto& value = it.value();
-        if (value.is_string()) {
-          setValue(attrs, key, value.get<std::string>());
-        } else if (value.is_number()) {
-          if (value.is_number_integer()) {
-            setValue(attrs, key, value.get<std::int32_t>());
-          } else if (value.is_number_float()) {
-            setValue(attrs, key, value.get<float>());
-          }
-        } else if (value.is_boolean()) {
-          setValue(attrs, key, value.get<std::uint8_t>());
-        } else {
-          throw std::runtime_error("Value type for key \"" + key + "\" is unsupported.");
+    std::string_view text = file->view();
+    nlohmann::json::parse(text.begin(), text.end()).get_to(tuning);
+  } catch (const std::exception& error) {
+    std::cout << "ERROR: Tuning file not formatted correctly..." << std::endl;
+    std::cerr << error.what() << std::endl;
+  }
+}
+
+nlohmann::json jino::JsonReader::readDocument(const std::filesystem::path& path) {
+  MappedFile file(path);
+  std::string inflated;
+  const std::string_view text = getText(file, path, inflated);
+  switch (getStateFormat(path)) {
+    case consts::eCBOR: return nlohmann::json::from_cbor(text.begin(), text.end());
+    case consts::eMessagePack: return nlohmann::json::from_msgpack(text.begin(), text.end());
+    case consts::eNetCDF: throw std::invalid_argument("NetCDF state is only read whole.");
+    default: return nlohmann::json::parse(text.begin(), text.end());
+  }
+}
+
+// Follows the chain of previous checkpoints back to a full one, then applies the patches forwards
+nlohmann::json jino::JsonReader::readDeltas(const std::filesystem::path& path) {
+  std::vector<nlohmann::json> patches;
+  std::set<std::filesystem::path> visited;
+  std::filesystem::path current = path;
+  while (isDelta(current) == true) {
+    if (visited.insert(std::filesystem::weakly_canonical(current)).second == false) {
+      throw std::runtime_error("Delta chain of \"" + path.string() + "\" loops back to \"" +
+                               current.string() + "\".");
+    }
+    nlohmann::json delta = readDocument(current);
+    patches.push_back(std::move(delta.at(consts::kDeltaPatch)));
+    current = path.parent_path() / delta.at(consts::kDeltaPrevious).get<std::string>();
+  }
+  nlohmann::json state = readDocument(current);
+  for (auto patch = patches.rbegin(); patch != patches.rend(); ++patch) {
+    state.patch_inplace(*patch);
+  }
+  return state;
+}
+
+void jino::JsonReader::parseParams(const std::string_view text, jino::Data& params) {
+  // Arranged alphabetically
+  nlohmann::json jsonData = nlohmann::json::parse(text.begin(), text.end());
+  if (jsonData.is_object() && jsonData.size() == consts::kParamNames.size()) {
+    for (std::uint64_t i = 0; i < jsonData.size(); ++i) {
+      const std::string& paramName = consts::kParamNames.at(i);
+      const std::uint8_t paramType = consts::kParamTypes.at(i);
+      if (jsonData.contains(paramName)) {
+        setValue(params, paramName, paramType, jsonData[paramName]);
+      } else {
+        throw std::out_of_range("Required parameter \"" + paramName + "\" not found in file.");
+      }
+    }
+  } else {
+    throw std::runtime_error("Incorrect file format.");
+  }
+}
+
+void jino::JsonReader::parseAttrs(const std::string_view text, jino::Data& attrs) {
+  // Arranged alphabetically
+  nlohmann::json jsonData = nlohmann::json::parse(text.begin(), text.end());
+  if (jsonData.is_object()) {
+    for (auto it = jsonData.begin(); it != jsonData.end(); ++it) {
+      const std::string& key = it.key();
+      const auto& value = it.value();
+      if (value.is_string()) {
+        setValue(attrs, key, value.get<std::string>());
+      } else if (value.is_number()) {
+        if (value.is_number_integer()) {
+          setValue(attrs, key, value.get<std::int32_t>());
+        } else if (value.is_number_float()) {
+          setValue(attrs, key, value.get<float>());
         }
+      } else if (value.is_boolean()) {
+        setValue(attrs, key, value.get<std::uint8_t>());
+      } else {
+        throw std::runtime_error("Value type for key \"" + key + "\" is unsupported.");
       }
-    } else {
-      throw std::runtime_error("Incorrect file format.");
     }
+  } else {
+    throw std::runtime_error("Incorrect file format.");
+  }
+}
+
+// The mapped bytes, or for compressed files their inflated copy
+std::string_view jino::JsonReader::getText(const MappedFile& file,
+                                           const std::filesystem::path& path,
+                                           std::string& inflated) {
+  if (isCompressed(path) == true) {
+    inflated = BlockGzip::decompress(file.view());
+    return inflated;
+  }
+  return file.view();
+}
+
+std::unique_ptr<jino::MappedFile> jino::JsonReader::mapText(const std::string& path) {
+  try {
+    return std::make_unique<MappedFile>(path);
   } catch (const std::exception& error) {
-    std::cout << "ERROR: Input file not formatted correctly..." << std::endl;
+    std::cout << "ERROR: Could not access file \"" << path << "\"..." << std::endl;
     std::cerr << error.what() << std::endl;
     std::exit(EXIT_FAILURE);
   }
@@ -171,6 +270,16 @@ void jino::JsonReader::setValue(Data& params, const std::string& paramName,
   }
 }
 
+template <std::uint8_t Param>
+void jino::JsonReader::setValue(Params& params, const nlohmann::json& jsonData) {
+  const std::string& paramName = consts::kParamNames.at(Param);
+  if (jsonData.contains(paramName)) {
+    params.set<Param>(jsonData[paramName].get<ParamType<Param>>());
+  } else {
+    throw std::out_of_range("Required parameter \"" + paramName + "\" not found in file.");
+  }
+}
+
 template <typename T>
 void jino::JsonReader::setValue(Data& params, const std::string& paramName, const T& value) {
   params.setValue(paramName, value);
@@ -0,0 +1,366 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include "JsonScanner.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace {
+// Each function returns a mask with bit i set where data[pos + i] is a quote, backslash, bracket
+// or brace, covering the 64 bytes from pos or the remainder of the text if that is shorter.
+using MaskFunction = std::uint64_t (*)(const char*, const std::uint64_t, const std::uint64_t);
+
+std::uint64_t maskScalar(const char* data, const std::uint64_t size, const std::uint64_t pos) {
+  std::uint64_t mask = 0;
+  const std::uint64_t end = std::min<std::uint64_t>(size - pos, 64);
+  for (std::uint64_t i = 0; i < end; ++i) {
+    switch (data[pos + i]) {
+      case '"':
+      case '\\':
+      case '[':
+      case ']':
+      case '{':
+      case '}': {
+        mask |= std::uint64_t{1} << i;
+        break;
+      }
+    }
+  }
+  return mask;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__((target("sse4.2")))
+std::uint64_t maskSse42(const char* data, const std::uint64_t size, const std::uint64_t pos) {
+  if (size - pos < 64) {
+    return maskScalar(data, size, pos);
+  }
+  static constexpr char kChars[16] = {'"', '\\', '[', ']', '{', '}'};
+  const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(kChars));
+  std::uint64_t mask = 0;
+  for (std::uint64_t i = 0; i < 64; i += 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos + i));
+    const __m128i matches = _mm_cmpestrm(chars, 6, block, 16, _SIDD_UBYTE_OPS |
+                                         _SIDD_CMP_EQUAL_ANY | _SIDD_BIT_MASK);
+    mask |= static_cast<std::uint64_t>(_mm_cvtsi128_si32(matches) & 0xFFFF) << i;
+  }
+  return mask;
+}
+
+__attribute__((target("avx2")))
+std::uint64_t maskAvx2(const char* data, const std::uint64_t size, const std::uint64_t pos) {
+  if (size - pos < 64) {
+    return maskScalar(data, size, pos);
+  }
+  std::uint64_t mask = 0;
+  for (std::uint64_t i = 0; i < 64; i += 32) {
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos + i));
+    __m256i matches = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('"'));
+    matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\\')));
+    // Brackets and braces differ from their ASCII neighbours only in bit 5, i.e. [ { and ] }
+    const __m256i folded = _mm256_or_si256(block, _mm256_set1_epi8(0x20));
+    matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('{')));
+    matches = _mm256_or_si256(matches, _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('}')));
+    mask |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(matches)))
+            << i;
+  }
+  return mask;
+}
+#endif
+
+struct Indexer {
+  const char* name;
+  MaskFunction mask;
+};
+
+Indexer selectIndexer() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_cpu_init();  // Selection runs during static initialisation
+  if (__builtin_cpu_supports("avx2")) {
+    return {"avx2", maskAvx2};
+  }
+  if (__builtin_cpu_supports("sse4.2")) {
+    return {"sse4.2", maskSse42};
+  }
+#endif
+  return {"scalar", maskScalar};
+}
+
+const Indexer kIndexer = selectIndexer();
+}  // Anonymous namespace
+
+jino::JsonScanner::JsonScanner(const std::string_view text) : text_(text) {}
+
+std::uint64_t jino::JsonScanner::skipWhitespace(std::uint64_t pos) const {
+  while (pos < text_.size() && (text_[pos] == ' ' || text_[pos] == '\n' ||
+                                text_[pos] == '\r' || text_[pos] == '\t')) {
+    ++pos;
+  }
+  return pos;
+}
+
+std::uint64_t jino::JsonScanner::skipValue(std::uint64_t pos) const {
+  pos = skipWhitespace(pos);
+  if (pos >= text_.size()) {
+    fail(pos);
+  }
+  switch (text_[pos]) {
+    case '"': return skipString(pos);
+    case '{':
+    case '[': return skipNested(pos);
+    case ',':
+    case ':':
+    case '}':
+    case ']': fail(pos);
+  }
+  return skipScalar(pos);
+}
+
+std::uint64_t jino::JsonScanner::forEachMember(std::uint64_t pos, const std::function<void(
+                                               const std::string&, const std::uint64_t,
+                                               const std::uint64_t)>& callback) const {
+  pos = expect(pos, '{');
+  pos = skipWhitespace(pos);
+  if (pos < text_.size() && text_[pos] == '}') {
+    return pos + 1;
+  }
+  std::string key;
+  while (true) {
+    pos = skipWhitespace(pos);
+    const std::uint64_t keyEnd = skipString(pos);
+    key.assign(text_.substr(pos + 1, keyEnd - pos - 2));  // Keys are matched unescaped
+    pos = expect(keyEnd, ':');
+    const std::uint64_t begin = skipWhitespace(pos);
+    pos = skipValue(begin);
+    callback(key, begin, pos);
+    pos = skipWhitespace(pos);
+    if (pos < text_.size() && text_[pos] == ',') {
+      ++pos;
+    } else {
+      return expect(pos, '}');
+    }
+  }
+}
+
+std::uint64_t jino::JsonScanner::forEachElement(std::uint64_t pos, const std::function<void(
+                                                const std::uint64_t,
+                                                const std::uint64_t)>& callback) const {
+  pos = expect(pos, '[');
+  pos = skipWhitespace(pos);
+  if (pos < text_.size() && text_[pos] == ']') {
+    return pos + 1;
+  }
+  while (true) {
+    const std::uint64_t begin = skipWhitespace(pos);
+    pos = skipValue(begin);
+    callback(begin, pos);
+    pos = skipWhitespace(pos);
+    if (pos < text_.size() && text_[pos] == ',') {
+      ++pos;
+    } else {
+      return expect(pos, ']');
+    }
+  }
+}
+
+std::pair<std::uint64_t, std::uint64_t> jino::JsonScanner::locate(
+    const std::string_view pointer, const std::uint64_t start) const {
+  if (pointer.empty() == false && pointer.front() != '/') {
+    throw std::invalid_argument("Invalid JSON pointer \"" + std::string(pointer) + "\".");
+  }
+  std::uint64_t pos = skipWhitespace(start);
+  std::string token;
+  for (std::uint64_t begin = 0; begin < pointer.size();) {
+    const std::uint64_t end = std::min(pointer.find('/', begin + 1), pointer.size());
+    token.clear();
+    for (std::uint64_t i = begin + 1; i < end; ++i) {  // Unescapes ~0 and ~1
+      if (pointer[i] == '~' && i + 1 < end && (pointer[i + 1] == '0' || pointer[i + 1] == '1')) {
+        token.push_back(pointer[++i] == '0' ? '~' : '/');
+      } else {
+        token.push_back(pointer[i]);
+      }
+    }
+    pos = locateChild(pos, token);
+    begin = end;
+  }
+  return {pos, skipValue(pos)};
+}
+
+const char* jino::JsonScanner::getInstructionSet() {
+  return kIndexer.name;
+}
+
+std::string_view jino::JsonScanner::view(const std::uint64_t begin, const std::uint64_t end) const {
+  return text_.substr(begin, end - begin);
+}
+
+// Offset of the member or element named by one pointer token within the value at pos
+std::uint64_t jino::JsonScanner::locateChild(std::uint64_t pos, const std::string& token) const {
+  if (pos < text_.size() && text_[pos] == '{') {
+    pos = skipWhitespace(pos + 1);
+    while (pos < text_.size() && text_[pos] != '}') {
+      const std::uint64_t keyEnd = skipString(pos);
+      const std::string_view key = text_.substr(pos + 1, keyEnd - pos - 2);
+      const std::uint64_t begin = skipWhitespace(expect(keyEnd, ':'));
+      if (key == token) {
+        return begin;
+      }
+      pos = skipWhitespace(skipValue(begin));
+      if (pos < text_.size() && text_[pos] == ',') {
+        pos = skipWhitespace(pos + 1);
+      }
+    }
+  } else if (pos < text_.size() && text_[pos] == '[') {
+    std::uint64_t index = 0;
+    const std::from_chars_result result = std::from_chars(token.data(),
+                                                          token.data() + token.size(), index);
+    if (token.empty() == false && result.ec == std::errc() &&
+        result.ptr == token.data() + token.size()) {
+      pos = skipWhitespace(pos + 1);
+      for (; pos < text_.size() && text_[pos] != ']'; --index) {
+        if (index == 0) {
+          return pos;
+        }
+        pos = skipWhitespace(skipValue(pos));
+        if (pos < text_.size() && text_[pos] == ',') {
+          pos = skipWhitespace(pos + 1);
+        }
+      }
+    }
+  }
+  throw std::out_of_range("No value for JSON pointer token \"" + token + "\".");
+}
+
+std::uint64_t jino::JsonScanner::skipString(std::uint64_t pos) const {
+  if (pos >= text_.size() || text_[pos] != '"') {
+    fail(pos);
+  }
+  return skipNested(pos);
+}
+
+// Walks the structural characters of the string, array or object starting at pos one 64-byte
+// mask at a time. Within strings only the closing quote counts and escaped characters are passed.
+std::uint64_t jino::JsonScanner::skipNested(const std::uint64_t pos) const {
+  std::uint64_t depth = 0;
+  std::uint64_t resume = pos;
+  std::uint8_t isString = false;
+  for (std::uint64_t block = pos; block < text_.size(); block += 64) {
+    for (std::uint64_t mask = kIndexer.mask(text_.data(), text_.size(), block); mask != 0;
+         mask &= mask - 1) {
+      const std::uint64_t index = block + __builtin_ctzll(mask);
+      if (index < resume) {
+        continue;
+      }
+      switch (text_[index]) {
+        case '"': {
+          if (isString == true && depth == 0) {
+            return index + 1;
+          }
+          isString = !isString;
+          break;
+        }
+        case '\\': {
+          resume = index + 2;
+          break;
+        }
+        case '{':
+        case '[': {
+          if (isString == false) {
+            ++depth;
+          }
+          break;
+        }
+        case '}':
+        case ']': {
+          if (isString == false && --depth == 0) {
+            return index + 1;
+          }
+          break;
+        }
+      }
+    }
+  }
+  fail(text_.size());
+}
+
+// A literal or a number as RFC 8259 spells them. What follows is left to the caller, which
+// rejects anything but a delimiter, so "truex" and "1.2.3" fail there.
+std::uint64_t jino::JsonScanner::skipScalar(std::uint64_t pos) const {
+  for (const std::string_view literal : {"true", "false", "null"}) {
+    if (text_.substr(pos, literal.size()) == literal) {
+      return pos + literal.size();
+    }
+  }
+  const auto isDigit = [this](const std::uint64_t index) {
+    return index < text_.size() && text_[index] >= '0' && text_[index] <= '9';
+  };
+  const auto skipDigits = [this, &isDigit](std::uint64_t index) {
+    if (isDigit(index) == false) {
+      fail(index);
+    }
+    while (isDigit(index) == true) {
+      ++index;
+    }
+    return index;
+  };
+  if (text_[pos] == '-') {
+    ++pos;
+  }
+  if (pos < text_.size() && text_[pos] == '0') {
+    ++pos;  // No leading zeros
+  } else {
+    pos = skipDigits(pos);
+  }
+  if (pos < text_.size() && text_[pos] == '.') {
+    pos = skipDigits(pos + 1);
+  }
+  if (pos < text_.size() && (text_[pos] == 'e' || text_[pos] == 'E')) {
+    ++pos;
+    if (pos < text_.size() && (text_[pos] == '+' || text_[pos] == '-')) {
+      ++pos;
+    }
+    pos = skipDigits(pos);
+  }
+  return pos;
+}
+
+std::uint64_t jino::JsonScanner::expect(std::uint64_t pos, const char expected) const {
+  pos = skipWhitespace(pos);
+  if (pos >= text_.size() || text_[pos] != expected) {
+    fail(pos);
+  }
+  return pos + 1;
+}
+
+void jino::JsonScanner::fail(const std::uint64_t pos) const {
+  if (pos >= text_.size()) {
+    throw std::runtime_error("Unexpected end of input at offset " + std::to_string(pos) + ".");
+  }
+  throw std::runtime_error("Unexpected character \'" + std::string(1, text_[pos]) +
+                           "\' at offset " + std::to_string(pos) + ".");
+}
@@ -0,0 +1,70 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include "MappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <string>
+#include <system_error>
+
+jino::MappedFile::MappedFile(const std::filesystem::path& path) : data_(nullptr), size_(0) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    throw std::system_error(errno, std::generic_category(), "Could not open file");
+  }
+  struct stat status;
+  if (::fstat(fd, &status) == -1) {
+    int error = errno;
+    ::close(fd);
+    throw std::system_error(error, std::generic_category(), "Could not stat file");
+  }
+  size_ = static_cast<std::uint64_t>(status.st_size);
+  if (size_ != 0) {
+    void* address = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (address == MAP_FAILED) {
+      int error = errno;
+      ::close(fd);
+      throw std::system_error(error, std::generic_category(), "Could not map file");
+    }
+    ::madvise(address, size_, MADV_SEQUENTIAL);
+    data_ = static_cast<const char*>(address);
+  }
+  ::close(fd);  // The mapping keeps its own reference to the file
+}
+
+jino::MappedFile::~MappedFile() {
+  if (data_ != nullptr) {
+    ::munmap(const_cast<char*>(data_), size_);
+  }
+}
+
+const char* jino::MappedFile::data() const {
+  return data_;
+}
+
+std::uint64_t jino::MappedFile::size() const {
+  return size_;
+}
+
+std::string_view jino::MappedFile::view() const {
+  return std::string_view(data_, size_);
+}
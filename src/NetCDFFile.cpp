@@ -18,22 +18,146 @@
 #include "NetCDFFile.h"
 
 #include <netcdf>
+#include <netcdf_meta.h>
 
 #include <algorithm>
+#include <array>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
+#include "Constants.h"
+
+namespace {
+// Creation flags indexed by eFileFormats
+const std::array<std::int32_t, jino::consts::eNumberOfFileFormats> kFormatFlags = {
+  NC_NETCDF4,
+  NC_NETCDF4 | NC_CLASSIC_MODEL,
+  0,
+  NC_64BIT_OFFSET,
+  NC_64BIT_DATA
+};
+
+// The classic data model lacks unsigned, 64-bit and string types, CDF-5 only lacks strings
+std::uint8_t isSupported(const std::uint8_t format, const std::uint8_t dataType) {
+  switch (format) {
+    case jino::consts::eNetCDF4:
+      return true;
+    case jino::consts::eCDF5:
+      return dataType != jino::consts::eString;
+    default:
+      return dataType == jino::consts::eInt8 || dataType == jino::consts::eInt16 ||
+             dataType == jino::consts::eInt32 || dataType == jino::consts::eFloat ||
+             dataType == jino::consts::eDouble;
+  }
+}
+
+void check(const std::int32_t status) {
+  if (status != NC_NOERR) {
+    throw std::runtime_error(nc_strerror(status));
+  }
+}
+
+std::uint8_t inquireFormat(const netCDF::NcFile& file) {
+  std::int32_t format = NC_FORMAT_NETCDF4;
+  nc_inq_format(file.getId(), &format);
+  switch (format) {
+    case NC_FORMAT_NETCDF4_CLASSIC:
+      return jino::consts::eNetCDF4Classic;
+    case NC_FORMAT_CLASSIC:
+      return jino::consts::eClassic;
+    case NC_FORMAT_64BIT_OFFSET:
+      return jino::consts::e64BitOffset;
+    case NC_FORMAT_64BIT_DATA:
+      return jino::consts::eCDF5;
+    default:
+      return jino::consts::eNetCDF4;
+  }
+}
+}  // anonymous namespace
+
 jino::NetCDFFile::NetCDFFile(const std::filesystem::path& path,
                              const netCDF::NcFile::FileMode mode) :
-                 path_(path), mode_(mode), netCDF_(path_, mode_) {}
+                 path_(path), mode_(mode), format_(consts::eNetCDF4), isDiskless_(false),
+                 bytes_(0), netCDF_(path_, mode_) {
+  if (mode_ == netCDF::NcFile::read || mode_ == netCDF::NcFile::write) {
+    format_ = inquireFormat(netCDF_);  // Existing files keep their own format
+  }
+}
 
 jino::NetCDFFile::NetCDFFile(const std::filesystem::path& path) :
-                 path_(path), mode_(netCDF::NcFile::replace), netCDF_(path_, mode_) {}
+                 NetCDFFile(path, netCDF::NcFile::replace) {}
+
+jino::NetCDFFile::NetCDFFile(const std::filesystem::path& path, const std::uint8_t format,
+                             const std::uint8_t isDiskless) :
+                 path_(path), mode_(netCDF::NcFile::replace), format_(format),
+                 isDiskless_(isDiskless), bytes_(0) {
+  std::int32_t flags = kFormatFlags.at(format_) | NC_CLOBBER;
+  if (isDiskless_ == true) {
+    flags |= NC_DISKLESS | NC_PERSIST;  // Persisted to path_ on closing
+  }
+  netCDF_.create(path_, flags);
+}
 
 jino::NetCDFFile::~NetCDFFile() {
+  std::lock_guard<std::recursive_mutex> lock(getMutex());
   close();
 }
 
+std::recursive_mutex& jino::NetCDFFile::getMutex() {
+  static std::recursive_mutex netCDFMutex;
+  return netCDFMutex;
+}
+
+// Settings left unset fall back to those netCDF started with, not to an earlier profile's
+void jino::NetCDFFile::setDefaults(const NetCDFTuning& tuning) {
+  static const std::tuple<std::size_t, std::size_t, float> initialCache = [] {
+    std::size_t size = 0;
+    std::size_t slots = 0;
+    float preemption = 0;
+    check(nc_get_chunk_cache(&size, &slots, &preemption));
+    return std::make_tuple(size, slots, preemption);
+  }();
+  const auto& [size, slots, preemption] = initialCache;
+  check(nc_set_chunk_cache(tuning.cacheSize != 0 ? tuning.cacheSize : size,
+                           tuning.cacheSlots != 0 ? tuning.cacheSlots : slots,
+                           tuning.cachePreemption >= 0 ? tuning.cachePreemption : preemption));
+#if NC_VERSION_MAJOR > 4 || (NC_VERSION_MAJOR == 4 && NC_VERSION_MINOR >= 9)
+  static const std::pair<std::int32_t, std::int32_t> initialAlignment = [] {
+    std::int32_t threshold = 0;
+    std::int32_t alignment = 0;
+    check(nc_get_alignment(&threshold, &alignment));
+    return std::make_pair(threshold, alignment);
+  }();
+  if (tuning.alignThreshold != 0 || tuning.alignment != 0) {
+    check(nc_set_alignment(tuning.alignThreshold, tuning.alignment));
+  } else {
+    check(nc_set_alignment(initialAlignment.first, initialAlignment.second));
+  }
+#else
+  if (tuning.alignThreshold != 0 || tuning.alignment != 0) {
+    throw std::runtime_error("Alignment needs netCDF-C 4.9 or later.");
+  }
+#endif
+}
+
+// Applies to files opened as well as created, so variables already in the file are cached too
+void jino::NetCDFFile::tune(const NetCDFTuning& tuning) {
+  tuning_ = tuning;
+  if (tuning_.isFilled == false) {
+    std::int32_t oldMode = 0;
+    check(nc_set_fill(netCDF_.getId(), NC_NOFILL, &oldMode));
+  }
+  for (const auto& [name, var] : netCDF_.getVars(netCDF::NcGroup::ChildrenAndCurrent)) {
+    cacheVar(var);
+  }
+}
+
 void jino::NetCDFFile::addDimension(const std::string& name, const std::uint64_t size) {
   if (size != 0) {
     netCDF_.addDim(name, size);
@@ -44,16 +168,22 @@ void jino::NetCDFFile::addDimension(const std::string& name, const std::uint64_t
 
 void jino::NetCDFFile::addVariable(const std::string& name, const std::string& typeName,
                                    const std::string& dimName) {
-  netCDF_.addVar(name, typeName, dimName);
+  checkType(name, typeName);
+  cacheVar(netCDF_.addVar(name, typeName, dimName));
 }
 
 void jino::NetCDFFile::addVariable(const std::string& name, const std::string& groupName,
                                    const std::string& typeName, const std::string& dimName) {
+  if (hasGroups() == false) {
+    addVariable(groupName + consts::kGroupSeparator + name, typeName, dimName);
+    return;
+  }
+  checkType(name, typeName);
   netCDF::NcGroup group = netCDF_.getGroup(groupName);
   if (group.isNull() == true) {
     group = netCDF_.addGroup(groupName);
   }
-  group.addVar(name, typeName, dimName);
+  cacheVar(group.addVar(name, typeName, dimName));
 }
 
 template <>
@@ -112,10 +242,26 @@ void jino::NetCDFFile::addAttribute(const std::string& name, const std::string a
   netCDF_.putAtt(name, attr);
 }
 
+void jino::NetCDFFile::addLabels(const std::string& name, const std::string& groupName,
+                                 const std::vector<std::string>& labels) {
+  netCDF::NcVar var = getVar(name, groupName);
+  std::vector<std::int8_t> codes(labels.size());
+  std::string meanings;
+  for (std::uint64_t code = 0; code < labels.size(); ++code) {
+    codes[code] = static_cast<std::int8_t>(code);  // As DictBuffer encodes them
+    std::string meaning = labels[code];
+    std::replace(meaning.begin(), meaning.end(), ' ', '_');  // CF meanings are blank separated
+    meanings += (code == 0 ? consts::kEmptyString : " ") + meaning;
+  }
+  var.putAtt(consts::kFlagValues, netCDF::NcType::nc_BYTE, codes.size(), codes.data());
+  var.putAtt(consts::kFlagMeanings, meanings);
+}
+
 template <typename T>
 void jino::NetCDFFile::addData(const std::string& name, const std::vector<T>& data) {
   netCDF::NcVar var = netCDF_.getVar(name);
   var.putVar(data.data());
+  bytes_ += getBytes(data.data(), data.size());
 }
 
 template void jino::NetCDFFile::addData<std::int8_t>(const std::string&,
@@ -148,14 +294,15 @@ void jino::NetCDFFile::addData<std::uint64_t>(const std::string& name,
   });
   netCDF::NcVar var = netCDF_.getVar(name);
   var.putVar(castedData.data());
+  bytes_ += getBytes(data.data(), data.size());
 }
 
 template <typename T>
 void jino::NetCDFFile::addData(const std::string& name, const std::string& groupName,
                                const std::vector<T>& data) {
-  netCDF::NcGroup group = netCDF_.getGroup(groupName);
-  netCDF::NcVar var = group.getVar(name);
+  netCDF::NcVar var = getVar(name, groupName);
   var.putVar(data.data());
+  bytes_ += getBytes(data.data(), data.size());
 }
 
 template void jino::NetCDFFile::addData<std::int8_t>(const std::string&, const std::string&,
@@ -186,9 +333,118 @@ void jino::NetCDFFile::addData<std::uint64_t>(const std::string& name, const std
   std::transform(data.begin(), data.end(), castedData.begin(), [](std::uint64_t value) {
     return static_cast<unsigned long long>(value);  /// NOLINT(runtime/int)
   });
-  netCDF::NcGroup group = netCDF_.getGroup(groupName);
-  netCDF::NcVar var = group.getVar(name);
+  netCDF::NcVar var = getVar(name, groupName);
   var.putVar(castedData.data());
+  bytes_ += getBytes(data.data(), data.size());
+}
+
+template <typename T>
+void jino::NetCDFFile::addData(const std::string& name, const std::uint64_t start,
+                               const std::uint64_t count, const T* data) {
+  netCDF::NcVar var = netCDF_.getVar(name);
+  var.putVar({start}, {count}, data);
+  bytes_ += getBytes(data, count);
+}
+
+template void jino::NetCDFFile::addData<std::int8_t>(const std::string&, const std::uint64_t,
+                                                     const std::uint64_t, const std::int8_t*);
+template void jino::NetCDFFile::addData<std::int16_t>(const std::string&, const std::uint64_t,
+                                                      const std::uint64_t, const std::int16_t*);
+template void jino::NetCDFFile::addData<std::int32_t>(const std::string&, const std::uint64_t,
+                                                      const std::uint64_t, const std::int32_t*);
+template void jino::NetCDFFile::addData<std::int64_t>(const std::string&, const std::uint64_t,
+                                                      const std::uint64_t, const std::int64_t*);
+template void jino::NetCDFFile::addData<std::uint8_t>(const std::string&, const std::uint64_t,
+                                                      const std::uint64_t, const std::uint8_t*);
+template void jino::NetCDFFile::addData<std::uint16_t>(const std::string&, const std::uint64_t,
+                                                       const std::uint64_t, const std::uint16_t*);
+template void jino::NetCDFFile::addData<std::uint32_t>(const std::string&, const std::uint64_t,
+                                                       const std::uint64_t, const std::uint32_t*);
+template void jino::NetCDFFile::addData<float>(const std::string&, const std::uint64_t,
+                                               const std::uint64_t, const float*);
+template void jino::NetCDFFile::addData<double>(const std::string&, const std::uint64_t,
+                                                const std::uint64_t, const double*);
+
+template<>
+void jino::NetCDFFile::addData<std::uint64_t>(const std::string& name, const std::uint64_t start,
+                                              const std::uint64_t count,
+                                              const std::uint64_t* data) {
+  std::vector<unsigned long long> castedData(data, data + count);  /// NOLINT(runtime/int)
+  netCDF::NcVar var = netCDF_.getVar(name);
+  var.putVar({start}, {count}, castedData.data());
+  bytes_ += getBytes(data, count);
+}
+
+template<>
+void jino::NetCDFFile::addData<std::string>(const std::string& name, const std::uint64_t start,
+                                            const std::uint64_t count, const std::string* data) {
+  std::vector<const char*> strData(count);
+  std::transform(data, data + count, strData.begin(), [](const std::string& value) {
+    return value.c_str();
+  });
+  netCDF::NcVar var = netCDF_.getVar(name);
+  var.putVar({start}, {count}, strData.data());
+  bytes_ += getBytes(data, count);
+}
+
+template <typename T>
+void jino::NetCDFFile::addData(const std::string& name, const std::string& groupName,
+                               const std::uint64_t start, const std::uint64_t count,
+                               const T* data) {
+  netCDF::NcVar var = getVar(name, groupName);
+  var.putVar({start}, {count}, data);
+  bytes_ += getBytes(data, count);
+}
+
+template void jino::NetCDFFile::addData<std::int8_t>(const std::string&, const std::string&,
+                                                     const std::uint64_t, const std::uint64_t,
+                                                     const std::int8_t*);
+template void jino::NetCDFFile::addData<std::int16_t>(const std::string&, const std::string&,
+                                                      const std::uint64_t, const std::uint64_t,
+                                                      const std::int16_t*);
+template void jino::NetCDFFile::addData<std::int32_t>(const std::string&, const std::string&,
+                                                      const std::uint64_t, const std::uint64_t,
+                                                      const std::int32_t*);
+template void jino::NetCDFFile::addData<std::int64_t>(const std::string&, const std::string&,
+                                                      const std::uint64_t, const std::uint64_t,
+                                                      const std::int64_t*);
+template void jino::NetCDFFile::addData<std::uint8_t>(const std::string&, const std::string&,
+                                                      const std::uint64_t, const std::uint64_t,
+                                                      const std::uint8_t*);
+template void jino::NetCDFFile::addData<std::uint16_t>(const std::string&, const std::string&,
+                                                       const std::uint64_t, const std::uint64_t,
+                                                       const std::uint16_t*);
+template void jino::NetCDFFile::addData<std::uint32_t>(const std::string&, const std::string&,
+                                                       const std::uint64_t, const std::uint64_t,
+                                                       const std::uint32_t*);
+template void jino::NetCDFFile::addData<float>(const std::string&, const std::string&,
+                                               const std::uint64_t, const std::uint64_t,
+                                               const float*);
+template void jino::NetCDFFile::addData<double>(const std::string&, const std::string&,
+                                                const std::uint64_t, const std::uint64_t,
+                                                const double*);
+
+template<>
+void jino::NetCDFFile::addData<std::uint64_t>(const std::string& name, const std::string& groupName,
+                                              const std::uint64_t start, const std::uint64_t count,
+                                              const std::uint64_t* data) {
+  std::vector<unsigned long long> castedData(data, data + count);  /// NOLINT(runtime/int)
+  netCDF::NcVar var = getVar(name, groupName);
+  var.putVar({start}, {count}, castedData.data());
+  bytes_ += getBytes(data, count);
+}
+
+template<>
+void jino::NetCDFFile::addData<std::string>(const std::string& name, const std::string& groupName,
+                                            const std::uint64_t start, const std::uint64_t count,
+                                            const std::string* data) {
+  std::vector<const char*> strData(count);
+  std::transform(data, data + count, strData.begin(), [](const std::string& value) {
+    return value.c_str();
+  });
+  netCDF::NcVar var = getVar(name, groupName);
+  var.putVar({start}, {count}, strData.data());
+  bytes_ += getBytes(data, count);
 }
 
 template <typename T>
@@ -196,7 +452,7 @@ void jino::NetCDFFile::addDatum(const std::string& name, const std::uint64_t ind
   netCDF::NcVar var = netCDF_.getVar(name);
   std::vector<uint64_t> indexVec = {index};
   var.putVar(indexVec, datum);
-  netCDF_.sync();
+  sync(getBytes(&datum, 1));
 }
 
 template void jino::NetCDFFile::addDatum<std::int8_t>(const std::string&, const std::uint64_t,
@@ -226,17 +482,16 @@ void jino::NetCDFFile::addDatum(const std::string& name,  const std::uint64_t in
   netCDF::NcVar var = netCDF_.getVar(name);
   std::vector<uint64_t> indexVec = {index};
   var.putVar(indexVec, static_cast<unsigned long long>(datum));  /// NOLINT(runtime/int)
-  netCDF_.sync();
+  sync(getBytes(&datum, 1));
 }
 
 template <typename T>
 void jino::NetCDFFile::addDatum(const std::string& name, const std::string& groupName,
                                 const std::uint64_t index, const T datum) {
-  netCDF::NcGroup group = netCDF_.getGroup(groupName);
-  netCDF::NcVar var = group.getVar(name);
+  netCDF::NcVar var = getVar(name, groupName);
   std::vector<uint64_t> indexVec = {index};
   var.putVar(indexVec, datum);
-  netCDF_.sync();
+  sync(getBytes(&datum, 1));
 }
 
 template void jino::NetCDFFile::addDatum<std::int8_t>(const std::string&, const std::string&,
@@ -263,13 +518,112 @@ template void jino::NetCDFFile::addDatum<std::string>(const std::string&, const
 template <>
 void jino::NetCDFFile::addDatum(const std::string& name, const std::string& groupName,
                                 const std::uint64_t index, const std::uint64_t datum) {
-  netCDF::NcGroup group = netCDF_.getGroup(groupName);
-  netCDF::NcVar var = group.getVar(name);
+  netCDF::NcVar var = getVar(name, groupName);
   std::vector<uint64_t> indexVec = {index};
   var.putVar(indexVec, static_cast<unsigned long long>(datum));  /// NOLINT(runtime/int)
-  netCDF_.sync();
+  sync(getBytes(&datum, 1));
+}
+
+// Current length of the variable along its first dimension
+std::uint64_t jino::NetCDFFile::getRecordCount(const std::string& name,
+                                               const std::string& groupName) const {
+  netCDF::NcVar var = getVar(name, groupName);
+  if (var.isNull() == true) {
+    throw std::out_of_range("Variable \"" + name + "\" not found in file.");
+  }
+  return var.getDim(0).getSize();
+}
+
+// The flag_meanings written by addLabels, blanks in a label come back as underscores
+std::vector<std::string> jino::NetCDFFile::getLabels(const std::string& name,
+                                                     const std::string& groupName) const {
+  std::vector<std::string> labels;
+  const std::map<std::string, netCDF::NcVarAtt> atts = getVar(name, groupName).getAtts();
+  const auto att = atts.find(consts::kFlagMeanings);
+  if (att != atts.end()) {
+    std::string meanings;
+    att->second.getValues(meanings);
+    std::istringstream stream(meanings);
+    std::string meaning;
+    while (stream >> meaning) {
+      labels.push_back(meaning);
+    }
+  }
+  return labels;
+}
+
+const std::filesystem::path& jino::NetCDFFile::getPath() const {
+  return path_;
+}
+
+std::uint8_t jino::NetCDFFile::getFormat() const {
+  return format_;
+}
+
+std::uint8_t jino::NetCDFFile::hasGroups() const {
+  return format_ == consts::eNetCDF4;
+}
+
+std::uint8_t jino::NetCDFFile::isDiskless() const {
+  return isDiskless_;
+}
+
+std::uint64_t jino::NetCDFFile::getBytesWritten() const {
+  return bytes_;
+}
+
+netCDF::NcGroup jino::NetCDFFile::getRoot() const {
+  return netCDF_;
 }
 
 void jino::NetCDFFile::close() {
   netCDF_.close();
 }
+
+netCDF::NcVar jino::NetCDFFile::getVar(const std::string& name,
+                                       const std::string& groupName) const {
+  if (groupName == consts::kEmptyString) {
+    return netCDF_.getVar(name);
+  }
+  if (hasGroups() == false) {
+    return netCDF_.getVar(groupName + consts::kGroupSeparator + name);
+  }
+  netCDF::NcGroup group = netCDF_.getGroup(groupName);
+  if (group.isNull() == true) {
+    return netCDF::NcVar();
+  }
+  return group.getVar(name);
+}
+
+void jino::NetCDFFile::checkType(const std::string& name, const std::string& typeName) const {
+  const auto it = std::find(consts::kDataTypeNames.begin(), consts::kDataTypeNames.end(),
+                            typeName);
+  const std::uint8_t dataType = static_cast<std::uint8_t>(it - consts::kDataTypeNames.begin());
+  if (it == consts::kDataTypeNames.end() || isSupported(format_, dataType) == false) {
+    throw std::invalid_argument("Type \"" + typeName + "\" of variable \"" + name +
+                                "\" is not supported by the file format.");
+  }
+}
+
+// Flushes each datum to disk, unless the file is diskless and only reaches it on closing
+void jino::NetCDFFile::sync(const std::uint64_t bytes) {
+  bytes_ += bytes;
+  if (isDiskless_ == false) {
+    netCDF_.sync();
+  }
+}
+
+// Only the HDF5 based formats have a chunk cache
+void jino::NetCDFFile::cacheVar(const netCDF::NcVar& var) const {
+  if (tuning_.varCacheSize != 0 &&
+      (format_ == consts::eNetCDF4 || format_ == consts::eNetCDF4Classic)) {
+    std::size_t size = 0;
+    std::size_t slots = 0;
+    float preemption = 0;
+    check(nc_get_chunk_cache(&size, &slots, &preemption));
+    check(nc_set_var_chunk_cache(var.getParentGroup().getId(), var.getId(), tuning_.varCacheSize,
+                                 tuning_.cacheSlots != 0 ? tuning_.cacheSlots : slots,
+                                 tuning_.cachePreemption >= 0 ? tuning_.cachePreemption :
+                                                                preemption));
+  }
+}
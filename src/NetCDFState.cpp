@@ -0,0 +1,77 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include "NetCDFState.h"
+
+#include <netcdf>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>  /// NOLINT
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Constants.h"
+
+namespace {
+// Indexed by eDataTypes
+const std::array<netCDF::NcType::ncType, jino::consts::eNumberOfDataTypes> kNcTypes = {
+  netCDF::NcType::nc_BYTE,
+  netCDF::NcType::nc_SHORT,
+  netCDF::NcType::nc_INT,
+  netCDF::NcType::nc_INT64,
+  netCDF::NcType::nc_UBYTE,
+  netCDF::NcType::nc_USHORT,
+  netCDF::NcType::nc_UINT,
+  netCDF::NcType::nc_UINT64,
+  netCDF::NcType::nc_FLOAT,
+  netCDF::NcType::nc_DOUBLE,
+  netCDF::NcType::nc_STRING
+};
+}  // anonymous namespace
+
+jino::NetCDFState::NetCDFState(const std::filesystem::path& path,
+                               const netCDF::NcFile::FileMode mode) : file_(path, mode) {}
+
+netCDF::NcType jino::NetCDFState::getType(const std::uint8_t dataType) {
+  return netCDF::NcType(kNcTypes.at(dataType));
+}
+
+netCDF::NcGroup jino::NetCDFState::getGroup(const netCDF::NcGroup& group,
+                                            const std::string& name) {
+  netCDF::NcGroup subgroup = group.getGroup(name);
+  if (subgroup.isNull() == true) {
+    throw std::runtime_error("State group \"" + name + "\" not found.");
+  }
+  return subgroup;
+}
+
+netCDF::NcVar jino::NetCDFState::getVar(const netCDF::NcGroup& group, const std::string& name) {
+  netCDF::NcVar var = group.getVar(name);
+  if (var.isNull() == true) {
+    throw std::runtime_error("State variable \"" + name + "\" not found.");
+  }
+  return var;
+}
+
+// Strings read from NetCDF are allocated by the library
+void jino::NetCDFState::freeStrings(std::vector<char*>& values) {
+  if (values.empty() == false) {
+    nc_free_string(values.size(), values.data());
+  }
+}
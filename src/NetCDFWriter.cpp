@@ -19,17 +19,30 @@
 
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <variant>
 
 #include "Buffer.h"
 #include "Buffers.h"
 #include "Constants.h"
-#include "Datum.h"
+#include "Data.h"
 #include "NetCDFFile.h"
 
-jino::NetCDFWriter::NetCDFWriter(const std::string& date) : date_(date) {}
+namespace {
+std::mutex pathMutex;  // Serialises file naming between writers sharing an output directory
+}  // anonymous namespace
+
+jino::NetCDFWriter::NetCDFWriter(const std::string& date) :
+                    NetCDFWriter(date, Buffers::get()) {}
+
+jino::NetCDFWriter::NetCDFWriter(const std::string& date, Buffers& buffers) :
+                    date_(date), buffers_(buffers), isResumed_(false),
+                    format_(consts::eNetCDF4), memoryCap_(0) {}
 
 void jino::NetCDFWriter::init() {
+  std::lock_guard<std::recursive_mutex> netCDFLock(NetCDFFile::getMutex());  // Taken first
+  std::lock_guard<std::mutex> lock(pathMutex);
   std::uint32_t count = 1;
   std::filesystem::path path(consts::kOutputDir + date_ + consts::kNCExtension);
   while (std::filesystem::exists(path) == true) {
@@ -37,23 +50,71 @@ void jino::NetCDFWriter::init() {
     ++count;
   }
   try {
-    file_ = std::make_unique<NetCDFFile>(path);
+    NetCDFFile::setDefaults(tuning_);
+    file_ = std::make_unique<NetCDFFile>(path, format_, memoryCap_ != 0);
+    file_->tune(tuning_);
+    path_ = path;
+  } catch (const std::exception& error) {
+    std::cerr << error.what() << std::endl;
+  }
+}
+
+// Reopens an existing file to carry on after its last records. Its metadata is kept and each
+// attached buffer continues from the current length of its variable, which needs an unlimited
+// dimension to grow, so nothing written before is rewritten. Encoded buffers carry on with the
+// file's labels. Buffers attached later are carried on when they are first written, which for
+// an encoded one fails if it has recorded labels that the file gives other codes.
+void jino::NetCDFWriter::resume(const std::filesystem::path& path) {
+  std::lock_guard<std::recursive_mutex> lock(NetCDFFile::getMutex());
+  try {
+    NetCDFFile::setDefaults(tuning_);
+    file_ = std::make_unique<NetCDFFile>(path, netCDF::NcFile::write);
+    file_->tune(tuning_);
+    path_ = path;
+    resumed_.clear();
+    buffers_.forEachBuffer([this](const BufferKey& key, BufferBase* const buffer) {
+      if (buffer != nullptr) {
+        resumeBuffer(key, buffer);
+      }
+    });
+    isResumed_ = true;
   } catch (const std::exception& error) {
+    std::cout << "ERROR: Could not resume file \"" << path << "\"..." << std::endl;
     std::cerr << error.what() << std::endl;
+    file_.reset();
   }
 }
 
+void jino::NetCDFWriter::setFormat(const std::uint8_t format) {
+  format_ = format;
+}
+
+void jino::NetCDFWriter::setDiskless(const std::uint64_t memoryCap) {
+  memoryCap_ = memoryCap;
+}
+
+void jino::NetCDFWriter::setTuning(const NetCDFTuning& tuning) {
+  tuning_ = tuning;
+}
+
 void jino::NetCDFWriter::writeMetadata(const NetCDFData& netCDFData) {
-  writeDims(netCDFData);
-  writeAttrs(netCDFData);
-  writeVars(netCDFData);
+  std::lock_guard<std::recursive_mutex> lock(NetCDFFile::getMutex());
+  if (isResumed_ == false) {
+    writeDims(netCDFData);
+    writeAttrs(netCDFData);
+    writeVars(netCDFData);
+  }
 }
 
 void jino::NetCDFWriter::writeDatums(const NetCDFData& netCDFData) {
+  std::lock_guard<std::recursive_mutex> lock(NetCDFFile::getMutex());
   NetCDFFile& file = getFile();
-  Buffers::get().forEachBuffer([this, &netCDFData, &file](const BufferKey& key,
+  buffers_.forEachBuffer([this, &netCDFData, &file](const BufferKey& key,
                                                           BufferBase* const buffer) {
     if (buffer != nullptr) {
+      if (isResumed_ == true) {
+        resumeBuffer(key, buffer);
+      }
       const std::string& groupName = key.groupName;
       if (groupName != consts::kEmptyString) {
         writeGroupedDatum(key.varName, groupName, file, buffer);
@@ -62,37 +123,60 @@ void jino::NetCDFWriter::writeDatums(const NetCDFData& netCDFData) {
       }
     }
   });
+  checkMemory();
 }
 
+// Every variable is defined before any is written, so classic formats leave define mode once
+// rather than once per variable
 void jino::NetCDFWriter::writeData(const NetCDFData& netCDFData) {
-  NetCDFFile& file = getFile();
-  Buffers::get().forEachBuffer([this, &netCDFData, &file](const BufferKey& key,
-                                                          BufferBase* const buffer) {
+  std::lock_guard<std::recursive_mutex> lock(NetCDFFile::getMutex());
+  if (isResumed_ == false) {
+    writeVars(netCDFData);
+  }
+  buffers_.forEachBuffer([this](const BufferKey& key, BufferBase* const buffer) {
     if (buffer != nullptr) {
-      const std::string& dimName = netCDFData.getDimensionName(buffer->size());
+      if (isResumed_ == true) {
+        resumeBuffer(key, buffer);
+      }
       const std::string& groupName = key.groupName;
       if (groupName != consts::kEmptyString) {
-        file.addVariable(key.varName, groupName,
-                         consts::kDataTypeNames[buffer->getType()], dimName);
-        writeGroupedData(key.varName, groupName, file, buffer);
+        writeGroupedData(key.varName, groupName, buffer);
       } else {
-        file.addVariable(key.varName, consts::kDataTypeNames[buffer->getType()], dimName);
-        writeUngroupedData(key.varName, file, buffer);
+        writeUngroupedData(key.varName, buffer);
       }
     }
   });
 }
 
 void jino::NetCDFWriter::toFile(const NetCDFData& netCDFData) {
-  writeDims(netCDFData);
-  writeAttrs(netCDFData);
+  std::lock_guard<std::recursive_mutex> lock(NetCDFFile::getMutex());
+  if (isResumed_ == false) {
+    writeDims(netCDFData);
+    writeAttrs(netCDFData);
+  }
   writeData(netCDFData);
   closeFile();
 }
 
 void jino::NetCDFWriter::closeFile() {
+  std::lock_guard<std::recursive_mutex> lock(NetCDFFile::getMutex());
+  writeLabels();
   getFile().close();
   file_.reset();
+  if (isResumed_ == true) {
+    buffers_.forEachBuffer([](const BufferKey&, BufferBase* const buffer) {
+      if (buffer != nullptr) {
+        buffer->setOffset(0);  // The next file starts afresh
+      }
+    });
+    resumed_.clear();
+    isResumed_ = false;
+  }
+}
+
+std::filesystem::path jino::NetCDFWriter::getPath() const {
+  std::lock_guard<std::recursive_mutex> lock(NetCDFFile::getMutex());  // Set under it too
+  return path_;
 }
 
 void jino::NetCDFWriter::writeDims(const NetCDFData& netCDFData) {
@@ -109,71 +193,17 @@ void jino::NetCDFWriter::writeDims(const NetCDFData& netCDFData) {
 void jino::NetCDFWriter::writeAttrs(const NetCDFData& netCDFData) {
   NetCDFFile& file = getFile();
   for (const auto& data : netCDFData.getData()) {
-    data->forEachDatum([&file](const std::string& key, DatumBase* const datum) {
-      switch (datum->getType()) {
-        case consts::eInt8: {
-          auto typedDatum = static_cast<Datum<std::int8_t>*>(datum);
-          file.addAttribute(key, typedDatum->getValue());
-          break;
-        }
-        case consts::eInt16: {
-          auto typedDatum = static_cast<Datum<std::int16_t>*>(datum);
-          file.addAttribute(key, typedDatum->getValue());
-          break;
-        }
-        case consts::eInt32: {
-          auto typedDatum = static_cast<Datum<std::int32_t>*>(datum);
-          file.addAttribute(key, typedDatum->getValue());
-          break;
-        }
-        case consts::eInt64: {
-          auto typedDatum = static_cast<Datum<std::int64_t>*>(datum);
-          file.addAttribute(key, typedDatum->getValue());
-          break;
-        }
-        case consts::eUInt8: {
-          auto typedDatum = static_cast<Datum<std::uint8_t>*>(datum);
-          file.addAttribute(key, typedDatum->getValue());
-          break;
-        }
-        case consts::eUInt16: {
-          auto typedDatum = static_cast<Datum<std::uint16_t>*>(datum);
-          file.addAttribute(key, typedDatum->getValue());
-          break;
-        }
-        case consts::eUInt32: {
-          auto typedDatum = static_cast<Datum<std::uint32_t>*>(datum);
-          file.addAttribute(key, typedDatum->getValue());
-          break;
-        }
-        case consts::eUInt64: {
-          auto typedDatum = static_cast<Datum<std::uint64_t>*>(datum);
-          file.addAttribute(key, typedDatum->getValue());
-          break;
-        }
-        case consts::eFloat: {
-          auto typedDatum = static_cast<Datum<float>*>(datum);
-          file.addAttribute(key, typedDatum->getValue());
-          break;
-        }
-        case consts::eDouble: {
-          auto typedDatum = static_cast<Datum<double>*>(datum);
-          file.addAttribute(key, typedDatum->getValue());
-          break;
-        }
-        case consts::eString: {
-          auto typedDatum = static_cast<Datum<std::string>*>(datum);
-          file.addAttribute(key, typedDatum->getValue());
-          break;
-        }
-      }
+    data->forEachDatum([&file](const std::string& key, const DataValue& value) {
+      std::visit([&file, &key](const auto& typedValue) {
+        file.addAttribute(key, typedValue);
+      }, value);
     });
   }
 }
 
 void jino::NetCDFWriter::writeVars(const NetCDFData& netCDFData) {
   NetCDFFile& file = getFile();
-  Buffers::get().forEachBuffer([&netCDFData, &file](const BufferKey& key,
+  buffers_.forEachBuffer([&netCDFData, &file](const BufferKey& key,
                                                     BufferBase* const buffer) {
     if (buffer != nullptr) {
       const std::string& dimName = netCDFData.getDimensionName(buffer->size());
@@ -188,9 +218,18 @@ void jino::NetCDFWriter::writeVars(const NetCDFData& netCDFData) {
   });
 }
 
+void jino::NetCDFWriter::writeLabels() {
+  NetCDFFile& file = getFile();
+  buffers_.forEachBuffer([&file](const BufferKey& key, BufferBase* const buffer) {
+    if (buffer != nullptr && buffer->getLabels().empty() == false) {
+      file.addLabels(key.varName, key.groupName, buffer->getLabels());
+    }
+  });
+}
+
 void jino::NetCDFWriter::writeGroupedDatum(const std::string& name,
                  const std::string& groupName, NetCDFFile& file, BufferBase* const buffer) {
-  const std::uint64_t index = buffer->getReadIndex();
+  const std::uint64_t index = buffer->getOffset() + buffer->getReadIndex();
   switch (buffer->getType()) {
     case consts::eInt8: {
       auto typedBuffer = static_cast<Buffer<std::int8_t>*>(buffer);
@@ -252,7 +291,7 @@ void jino::NetCDFWriter::writeGroupedDatum(const std::string& name,
 
 void jino::NetCDFWriter::writeUngroupedDatum(const std::string& name, NetCDFFile& file,
                                                  BufferBase* const buffer) {
-  const std::uint64_t index = buffer->getReadIndex();
+  const std::uint64_t index = buffer->getOffset() + buffer->getReadIndex();
   switch (buffer->getType()) {
     case consts::eInt8: {
       auto typedBuffer = static_cast<Buffer<std::int8_t>*>(buffer);
@@ -311,123 +350,118 @@ void jino::NetCDFWriter::writeUngroupedDatum(const std::string& name, NetCDFFile
     }
   }
 }
+
+// A diskless file is checked against its cap before each slab, as it may move to disk in between
+template <typename T>
+void jino::NetCDFWriter::writeSlabs(const std::string& name, const std::string& groupName,
+                                    BufferBase* const buffer) {
+  auto typedBuffer = static_cast<Buffer<T>*>(buffer);
+  typedBuffer->forEachSlab([&](const std::uint64_t start, const std::uint64_t count,
+                               const T* values) {
+    checkMemory(NetCDFFile::getBytes(values, count));
+    NetCDFFile& file = getFile();
+    if (groupName != consts::kEmptyString) {
+      file.addData<T>(name, groupName, buffer->getOffset() + start, count, values);
+    } else {
+      file.addData<T>(name, buffer->getOffset() + start, count, values);
+    }
+  });
+}
+
 void jino::NetCDFWriter::writeGroupedData(const std::string& name, const std::string& groupName,
-                                              NetCDFFile& file, BufferBase* const buffer) {
+                                          BufferBase* const buffer) {
   switch (buffer->getType()) {
     case consts::eInt8: {
-      auto typedBuffer = static_cast<Buffer<std::int8_t>*>(buffer);
-      file.addData<std::int8_t>(name, groupName, typedBuffer->getData());
+      writeSlabs<std::int8_t>(name, groupName, buffer);
       break;
     }
     case consts::eInt16: {
-      auto typedBuffer = static_cast<Buffer<std::int16_t>*>(buffer);
-      file.addData<std::int16_t>(name, groupName, typedBuffer->getData());
+      writeSlabs<std::int16_t>(name, groupName, buffer);
       break;
     }
     case consts::eInt32: {
-      auto typedBuffer = static_cast<Buffer<std::int32_t>*>(buffer);
-      file.addData<std::int32_t>(name, groupName, typedBuffer->getData());
+      writeSlabs<std::int32_t>(name, groupName, buffer);
       break;
     }
     case consts::eInt64: {
-      auto typedBuffer = static_cast<Buffer<std::int64_t>*>(buffer);
-      file.addData<std::int64_t>(name, groupName, typedBuffer->getData());
+      writeSlabs<std::int64_t>(name, groupName, buffer);
       break;
     }
     case consts::eUInt8: {
-      auto typedBuffer = static_cast<Buffer<std::uint8_t>*>(buffer);
-      file.addData<std::uint8_t>(name, groupName, typedBuffer->getData());
+      writeSlabs<std::uint8_t>(name, groupName, buffer);
       break;
     }
     case consts::eUInt16: {
-      auto typedBuffer = static_cast<Buffer<std::uint16_t>*>(buffer);
-      file.addData<std::uint16_t>(name, groupName, typedBuffer->getData());
+      writeSlabs<std::uint16_t>(name, groupName, buffer);
       break;
     }
     case consts::eUInt32: {
-      auto typedBuffer = static_cast<Buffer<std::uint32_t>*>(buffer);
-      file.addData<std::uint32_t>(name, groupName, typedBuffer->getData());
+      writeSlabs<std::uint32_t>(name, groupName, buffer);
       break;
     }
     case consts::eUInt64: {
-      auto typedBuffer = static_cast<Buffer<std::uint64_t>*>(buffer);
-      file.addData<std::uint64_t>(name, groupName, typedBuffer->getData());
+      writeSlabs<std::uint64_t>(name, groupName, buffer);
       break;
     }
     case consts::eFloat: {
-      auto typedBuffer = static_cast<Buffer<float>*>(buffer);
-      file.addData<float>(name, groupName, typedBuffer->getData());
+      writeSlabs<float>(name, groupName, buffer);
       break;
     }
     case consts::eDouble: {
-      auto typedBuffer = static_cast<Buffer<double>*>(buffer);
-      file.addData<double>(name, groupName, typedBuffer->getData());
+      writeSlabs<double>(name, groupName, buffer);
       break;
     }
     case consts::eString: {
-      auto typedBuffer = static_cast<Buffer<std::string>*>(buffer);
-      file.addData<std::string>(name, groupName, typedBuffer->getData());
+      writeSlabs<std::string>(name, groupName, buffer);
       break;
     }
   }
 }
 
-void jino::NetCDFWriter::writeUngroupedData(const std::string& name, NetCDFFile& file,
-                                                 BufferBase* const buffer) {
+void jino::NetCDFWriter::writeUngroupedData(const std::string& name, BufferBase* const buffer) {
   switch (buffer->getType()) {
     case consts::eInt8: {
-      auto typedBuffer = static_cast<Buffer<std::int8_t>*>(buffer);
-      file.addData<std::int8_t>(name, typedBuffer->getData());
+      writeSlabs<std::int8_t>(name, consts::kEmptyString, buffer);
       break;
     }
     case consts::eInt16: {
-      auto typedBuffer = static_cast<Buffer<std::int16_t>*>(buffer);
-      file.addData<std::int16_t>(name, typedBuffer->getData());
+      writeSlabs<std::int16_t>(name, consts::kEmptyString, buffer);
       break;
     }
     case consts::eInt32: {
-      auto typedBuffer = static_cast<Buffer<std::int32_t>*>(buffer);
-      file.addData<std::int32_t>(name, typedBuffer->getData());
+      writeSlabs<std::int32_t>(name, consts::kEmptyString, buffer);
       break;
     }
     case consts::eInt64: {
-      auto typedBuffer = static_cast<Buffer<std::int64_t>*>(buffer);
-      file.addData<std::int64_t>(name, typedBuffer->getData());
+      writeSlabs<std::int64_t>(name, consts::kEmptyString, buffer);
       break;
     }
     case consts::eUInt8: {
-      auto typedBuffer = static_cast<Buffer<std::uint8_t>*>(buffer);
-      file.addData<std::uint8_t>(name, typedBuffer->getData());
+      writeSlabs<std::uint8_t>(name, consts::kEmptyString, buffer);
       break;
     }
     case consts::eUInt16: {
-      auto typedBuffer = static_cast<Buffer<std::uint16_t>*>(buffer);
-      file.addData<std::uint16_t>(name, typedBuffer->getData());
+      writeSlabs<std::uint16_t>(name, consts::kEmptyString, buffer);
       break;
     }
     case consts::eUInt32: {
-      auto typedBuffer = static_cast<Buffer<std::uint32_t>*>(buffer);
-      file.addData<std::uint32_t>(name, typedBuffer->getData());
+      writeSlabs<std::uint32_t>(name, consts::kEmptyString, buffer);
       break;
     }
     case consts::eUInt64: {
-      auto typedBuffer = static_cast<Buffer<std::uint64_t>*>(buffer);
-      file.addData<std::uint64_t>(name, typedBuffer->getData());
+      writeSlabs<std::uint64_t>(name, consts::kEmptyString, buffer);
       break;
     }
     case consts::eFloat: {
-      auto typedBuffer = static_cast<Buffer<float>*>(buffer);
-      file.addData<float>(name, typedBuffer->getData());
+      writeSlabs<float>(name, consts::kEmptyString, buffer);
       break;
     }
     case consts::eDouble: {
-      auto typedBuffer = static_cast<Buffer<double>*>(buffer);
-      file.addData<double>(name, typedBuffer->getData());
+      writeSlabs<double>(name, consts::kEmptyString, buffer);
       break;
     }
     case consts::eString: {
-      auto typedBuffer = static_cast<Buffer<std::string>*>(buffer);
-      file.addData<std::string>(name, typedBuffer->getData());
+      writeSlabs<std::string>(name, consts::kEmptyString, buffer);
       break;
     }
   }
@@ -439,3 +473,25 @@ jino::NetCDFFile& jino::NetCDFWriter::getFile() {
   }
   return *file_;
 }
+
+// Continues a buffer after the records its variable already holds in the resumed file. Done
+// once per buffer, and again for a different buffer later attached under the same key.
+void jino::NetCDFWriter::resumeBuffer(const BufferKey& key, BufferBase* const buffer) {
+  const auto resumed = resumed_.find(key);
+  if (resumed == resumed_.end() || resumed->second != buffer) {
+    buffer->setOffset(file_->getRecordCount(key.varName, key.groupName));
+    buffer->setLabels(file_->getLabels(key.varName, key.groupName));
+    resumed_.insert_or_assign(key, buffer);
+  }
+}
+
+// Persists a diskless file that has outgrown its memory cap, or would with the bytes about to be
+// written, and carries on writing it on disk
+void jino::NetCDFWriter::checkMemory(const std::uint64_t bytes) {
+  if (file_->isDiskless() == true && file_->getBytesWritten() + bytes > memoryCap_) {
+    file_->close();
+    NetCDFFile::setDefaults(tuning_);
+    file_ = std::make_unique<NetCDFFile>(path_, netCDF::NcFile::write);
+    file_->tune(tuning_);
+  }
+}
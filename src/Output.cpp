@@ -19,9 +19,12 @@
 
 #include <chrono>
 #include <filesystem>  /// NOLINT
+#include <future>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 
 #include "Constants.h"
@@ -36,9 +39,14 @@ std::string getFormattedDateStr() {
   oss << std::put_time(std::localtime(&nowSeconds), dateFormat.c_str());
   return oss.str();
 }
+
+std::mutex pathMutex;  // Serialises file naming between outputs sharing a date
 }  // anonymous namespace
 
-jino::Output::Output() : date_(getFormattedDateStr()), writer_(date_) {
+jino::Output::Output() : Output(Buffers::get()) {}
+
+jino::Output::Output(Buffers& buffers) : date_(getFormattedDateStr()), writer_(date_, buffers),
+                                         checkpointCount_(0) {
   initOutDir();
 }
 
@@ -66,6 +74,50 @@ void jino::Output::closeNetCDF() {
   });
 }
 
+// Subsequent output is appended to an existing file, see NetCDFWriter::resume. Returns once it
+// is reopened, so encoded buffers hold its labels before they record again.
+void jino::Output::resumeNetCDF(const std::filesystem::path& path) {
+  std::packaged_task<void()> task([this, &path]() {
+    writer_.resume(path);
+  });
+  std::future<void> resumed = task.get_future();
+  threads_.enqueue(consts::eNetCDFThread, [&task]() {
+    task();
+  });
+  resumed.wait();
+}
+
+// Selects one of eFileFormats for NetCDF files opened after this call. The classic formats
+// write small scalar series faster than NetCDF-4 but flatten groups into variable names.
+void jino::Output::setNetCDFFormat(const std::uint8_t format) {
+  if (format >= consts::eNumberOfFileFormats) {
+    throw std::out_of_range("Unknown NetCDF file format " + std::to_string(format) + ".");
+  }
+  threads_.enqueue(consts::eNetCDFThread, [this, format]() {
+    writer_.setFormat(format);
+  });
+}
+
+// NetCDF files opened after this call are built in memory and written once on closing, which
+// suits short runs. One that outgrows the cap is persisted and continues on disk.
+void jino::Output::setNetCDFDiskless(const std::uint64_t memoryCap) {
+  threads_.enqueue(consts::eNetCDFThread, [this, memoryCap]() {
+    writer_.setDiskless(memoryCap);
+  });
+}
+
+// Applies a tuning profile, see JsonReader::readTuning, to NetCDF files opened after this call
+void jino::Output::setNetCDFTuning(const NetCDFTuning& tuning) {
+  threads_.enqueue(consts::eNetCDFThread, [this, tuning]() {
+    writer_.setTuning(tuning);
+  });
+}
+
+// Path of the current or last NetCDF file, once the NetCDF thread has opened it
+std::filesystem::path jino::Output::getNetCDFPath() const {
+  return writer_.getPath();
+}
+
 void jino::Output::waitForCompletion() {
   threads_.stopThreads();
 }
@@ -83,3 +135,37 @@ void jino::Output::initOutDir() const {
     std::cerr << error.what() << std::endl;
   }
 }
+
+std::filesystem::path jino::Output::reservePath(const std::string& extension) const {
+  std::lock_guard<std::mutex> lock(pathMutex);
+  std::uint32_t count = 1;
+  std::filesystem::path path(consts::kOutputDir + date_ + extension);
+  while (std::filesystem::exists(path) == true) {
+    path = consts::kOutputDir + date_ + "(" + std::to_string(count) + ")" + extension;
+    ++count;
+  }
+  std::ofstream file(path);  // Claims the name before the lock is released
+  return path;
+}
+
+std::filesystem::path jino::Output::reserveStatePath(const std::uint8_t format,
+                                                    const std::uint8_t isCompressed) const {
+  std::string extension = consts::kStateExtensions.at(format);
+  if (isCompressed == true && format != consts::eNetCDF) {
+    extension += consts::kGzipExtension;
+  }
+  return reservePath(extension);
+}
+
+void jino::Output::writePatch(const std::filesystem::path& path,
+                              const nlohmann::json& patch) const {
+  nlohmann::json delta;
+  delta[consts::kDeltaPrevious] = lastPath_.filename().string();
+  delta[consts::kDeltaPatch] = patch;
+  std::ofstream file(path);
+  file << delta.dump(consts::kJsonIndentSize);
+  file.close();
+  if (file.fail() == true) {
+    throw std::runtime_error("Could not write state delta.");
+  }
+}
@@ -0,0 +1,302 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include "ParallelWriter.h"
+
+#include <netcdf.h>
+#include <netcdf_par.h>
+
+#include <array>
+#include <exception>
+#include <filesystem>  /// NOLINT
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "Buffer.h"
+#include "Buffers.h"
+#include "Constants.h"
+#include "Data.h"
+#include "Types.h"
+
+namespace {
+// Indexed by eDataTypes
+const std::array<nc_type, jino::consts::eNumberOfDataTypes> kNcTypes = {
+  NC_BYTE, NC_SHORT, NC_INT, NC_INT64, NC_UBYTE, NC_USHORT, NC_UINT, NC_UINT64, NC_FLOAT,
+  NC_DOUBLE, NC_STRING
+};
+
+void check(const std::int32_t status) {
+  if (status != NC_NOERR) {
+    throw std::runtime_error(nc_strerror(status));
+  }
+}
+}  // anonymous namespace
+
+jino::ParallelWriter::ParallelWriter(const std::string& date, MPI_Comm comm) :
+                      ParallelWriter(date, Buffers::get(), comm) {}
+
+jino::ParallelWriter::ParallelWriter(const std::string& date, Buffers& buffers, MPI_Comm comm) :
+                      date_(date), buffers_(buffers), comm_(comm), rank_(0), fileId_(0),
+                      isOpen_(false), count_(0), offset_(0), total_(0) {
+  MPI_Comm_rank(comm_, &rank_);
+}
+
+jino::ParallelWriter::~ParallelWriter() {
+  if (isOpen_ == true) {
+    nc_close(fileId_);
+  }
+}
+
+// Rank 0 names the file, as in NetCDFWriter::init, and shares the name before all ranks create
+// it together.
+void jino::ParallelWriter::init() {
+  std::string path;
+  if (rank_ == 0) {
+    std::filesystem::create_directories(consts::kOutputDir);
+    std::uint32_t count = 1;
+    path = consts::kOutputDir + date_ + consts::kNCExtension;
+    while (std::filesystem::exists(path) == true) {
+      path = consts::kOutputDir + date_ + "(" + std::to_string(count) + ")" +
+             consts::kNCExtension;
+      ++count;
+    }
+  }
+  std::uint64_t size = path.size();
+  MPI_Bcast(&size, 1, MPI_UINT64_T, 0, comm_);
+  path.resize(size);
+  MPI_Bcast(path.data(), static_cast<std::int32_t>(size), MPI_CHAR, 0, comm_);
+  try {
+    check(nc_create_par(path.c_str(), NC_NETCDF4 | NC_CLOBBER, comm_, MPI_INFO_NULL, &fileId_));
+    path_ = path;
+    isOpen_ = true;
+  } catch (const std::exception& error) {
+    std::cout << "ERROR: Could not create file \"" << path << "\"..." << std::endl;
+    std::cerr << error.what() << std::endl;
+  }
+}
+
+// Defines the decomposed dimension at its global size, the attributes and one variable per
+// buffer, then writes each rank's records at its offset.
+void jino::ParallelWriter::toFile(const NetCDFData& netCDFData, const std::string& dimName) {
+  if (isOpen_ == false) {
+    init();
+  }
+  if (isAnyFailed(isOpen_ == false) == true) {
+    throw std::runtime_error("No parallel file open.");
+  }
+  decompose();
+  writeAttrs(netCDFData);
+  writeVars(dimName);
+  check(nc_enddef(fileId_));
+  writeData();
+}
+
+void jino::ParallelWriter::closeFile() {
+  if (isOpen_ == true) {
+    isOpen_ = false;
+    check(nc_close(fileId_));
+  }
+  groupIds_.clear();
+  varIds_.clear();
+}
+
+const std::filesystem::path& jino::ParallelWriter::getPath() const {
+  return path_;
+}
+
+std::uint64_t jino::ParallelWriter::getOffset() const {
+  return offset_;
+}
+
+// The buffers are checked on every rank before any of them enters a collective, so a rank that
+// rejects its buffers does not leave the others waiting on it
+void jino::ParallelWriter::decompose() {
+  std::exception_ptr error;
+  try {
+    std::uint8_t isFirst = true;
+    buffers_.forEachBuffer([this, &isFirst](const BufferKey&, BufferBase* const buffer) {
+      if (buffer != nullptr) {
+        if (buffer->getType() == consts::eString) {
+          throw std::invalid_argument("String buffers cannot be written in parallel.");
+        }
+        if (buffer->getLabels().empty() == false) {  // Each rank encodes its own labels
+          throw std::invalid_argument("Encoded buffers cannot be written in parallel.");
+        }
+        if (isFirst == true) {
+          count_ = buffer->getSpan();
+          isFirst = false;
+        } else if (buffer->getSpan() != count_) {
+          throw std::length_error("Buffers of a decomposed dimension must be equally filled.");
+        }
+      }
+    });
+  } catch (const std::exception&) {
+    error = std::current_exception();
+  }
+  if (isAnyFailed(error != nullptr) == true) {
+    if (error != nullptr) {
+      std::rethrow_exception(error);
+    }
+    throw std::runtime_error("Buffers of another rank cannot be written in parallel.");
+  }
+  offset_ = 0;
+  MPI_Exscan(&count_, &offset_, 1, MPI_UINT64_T, MPI_SUM, comm_);
+  if (rank_ == 0) {
+    offset_ = 0;  // Left undefined by MPI_Exscan
+  }
+  MPI_Allreduce(&count_, &total_, 1, MPI_UINT64_T, MPI_SUM, comm_);
+}
+
+// Collective, true on every rank if it is on any
+std::uint8_t jino::ParallelWriter::isAnyFailed(const std::uint8_t isFailed) const {
+  std::int32_t local = isFailed;
+  std::int32_t global = 0;
+  MPI_Allreduce(&local, &global, 1, MPI_INT, MPI_LOR, comm_);
+  return global != 0;
+}
+
+void jino::ParallelWriter::writeAttrs(const NetCDFData& netCDFData) {
+  for (const auto& data : netCDFData.getData()) {
+    data->forEachDatum([this](const std::string& key, const DataValue& value) {
+      std::visit([this, &key](const auto& typedValue) {
+        using T = std::decay_t<decltype(typedValue)>;
+        if constexpr (std::is_same_v<T, std::string>) {
+          check(nc_put_att_text(fileId_, NC_GLOBAL, key.c_str(), typedValue.size(),
+                                typedValue.c_str()));
+        } else {
+          check(nc_put_att(fileId_, NC_GLOBAL, key.c_str(), kNcTypes[Types<T>::type], 1,
+                           &typedValue));
+        }
+      }, value);
+    });
+  }
+}
+
+void jino::ParallelWriter::writeVars(const std::string& dimName) {
+  std::int32_t dimId = 0;
+  check(nc_def_dim(fileId_, dimName.c_str(), total_, &dimId));
+  buffers_.forEachBuffer([this, dimId](const BufferKey& key, BufferBase* const buffer) {
+    if (buffer != nullptr) {
+      const std::int32_t groupId = getGroupId(key.groupName);
+      std::int32_t varId = 0;
+      check(nc_def_var(groupId, key.varName.c_str(), kNcTypes[buffer->getType()], 1, &dimId,
+                       &varId));
+      groupIds_.push_back(groupId);
+      varIds_.push_back(varId);
+    }
+  });
+}
+
+void jino::ParallelWriter::writeData() {
+  std::uint64_t index = 0;
+  buffers_.forEachBuffer([this, &index](const BufferKey&, BufferBase* const buffer) {
+    if (buffer != nullptr) {
+      const std::int32_t groupId = groupIds_[index];
+      const std::int32_t varId = varIds_[index];
+      check(nc_var_par_access(groupId, varId, NC_COLLECTIVE));
+      switch (buffer->getType()) {
+        case consts::eInt8: {
+          writeSlab<std::int8_t>(groupId, varId, buffer);
+          break;
+        }
+        case consts::eInt16: {
+          writeSlab<std::int16_t>(groupId, varId, buffer);
+          break;
+        }
+        case consts::eInt32: {
+          writeSlab<std::int32_t>(groupId, varId, buffer);
+          break;
+        }
+        case consts::eInt64: {
+          writeSlab<std::int64_t>(groupId, varId, buffer);
+          break;
+        }
+        case consts::eUInt8: {
+          writeSlab<std::uint8_t>(groupId, varId, buffer);
+          break;
+        }
+        case consts::eUInt16: {
+          writeSlab<std::uint16_t>(groupId, varId, buffer);
+          break;
+        }
+        case consts::eUInt32: {
+          writeSlab<std::uint32_t>(groupId, varId, buffer);
+          break;
+        }
+        case consts::eUInt64: {
+          writeSlab<std::uint64_t>(groupId, varId, buffer);
+          break;
+        }
+        case consts::eFloat: {
+          writeSlab<float>(groupId, varId, buffer);
+          break;
+        }
+        case consts::eDouble: {
+          writeSlab<double>(groupId, varId, buffer);
+          break;
+        }
+      }
+      ++index;
+    }
+  });
+}
+
+// Puts each of the rank's slabs at its own start, so the gap a partly filled partition leaves
+// stays unwritten as in the serial writer. Every rank must make the same number of collective
+// calls, so ranks with fewer slabs make up the difference with empty puts.
+template <typename T>
+void jino::ParallelWriter::writeSlab(const std::int32_t groupId, const std::int32_t varId,
+                                     BufferBase* const buffer) {
+  std::vector<std::array<std::size_t, 2>> slabs;
+  std::vector<const T*> values;
+  static_cast<Buffer<T>*>(buffer)->forEachSlab([this, &slabs, &values](const std::uint64_t start,
+                                                                      const std::uint64_t count,
+                                                                      const T* data) {
+    if (count != 0) {
+      slabs.push_back({offset_ + start, count});
+      values.push_back(data);
+    }
+  });
+  std::uint64_t numSlabs = slabs.size();
+  std::uint64_t maxSlabs = 0;
+  MPI_Allreduce(&numSlabs, &maxSlabs, 1, MPI_UINT64_T, MPI_MAX, comm_);
+  const T empty{};
+  for (std::uint64_t i = 0; i < maxSlabs; ++i) {
+    if (i < numSlabs) {
+      check(nc_put_vara(groupId, varId, &slabs[i][0], &slabs[i][1], values[i]));
+    } else {
+      const std::size_t start = offset_;
+      const std::size_t count = 0;
+      check(nc_put_vara(groupId, varId, &start, &count, &empty));
+    }
+  }
+}
+
+std::int32_t jino::ParallelWriter::getGroupId(const std::string& groupName) {
+  if (groupName == consts::kEmptyString) {
+    return fileId_;
+  }
+  std::int32_t groupId = 0;
+  if (nc_inq_grp_ncid(fileId_, groupName.c_str(), &groupId) != NC_NOERR) {
+    check(nc_def_grp(fileId_, groupName.c_str(), &groupId));
+  }
+  return groupId;
+}
@@ -0,0 +1,115 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include "StateIndex.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <filesystem>  /// NOLINT
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "Constants.h"
+#include "MappedFile.h"
+
+namespace {
+// First reference token of a JSON pointer, or an empty view if there is none
+std::string_view getToken(const std::string_view pointer) {
+  if (pointer.empty() == true || pointer.front() != '/') {
+    return {};
+  }
+  return pointer.substr(1, std::min(pointer.find('/', 1), pointer.size()) - 1);
+}
+}  // anonymous namespace
+
+std::filesystem::path jino::StateIndex::getPath(const std::filesystem::path& statePath) {
+  return statePath.string() + consts::kIndexExtension;
+}
+
+void jino::StateIndex::addMember(const std::string& name, const std::uint64_t offset) {
+  members_[name] = offset;
+}
+
+std::vector<std::uint64_t>& jino::StateIndex::getElements(const std::string& name) {
+  return elements_[name];
+}
+
+std::uint8_t jino::StateIndex::isEmpty() const {
+  return members_.empty();
+}
+
+// Offset of the deepest value on the pointer that is indexed, with the pointer advanced past the
+// tokens it resolves. Returns 0 with the pointer as it was if the index does not cover it.
+std::uint64_t jino::StateIndex::seek(std::string_view& pointer) const {
+  const std::string_view name = getToken(pointer);
+  const auto member = members_.find(name);
+  if (pointer.empty() == true || name.find('~') != std::string_view::npos ||
+      member == members_.end()) {
+    return 0;  // Escaped names are left to the scanner
+  }
+  std::uint64_t offset = member->second;
+  pointer.remove_prefix(name.size() + 1);
+  const auto elements = elements_.find(name);
+  const std::string_view token = getToken(pointer);
+  if (elements != elements_.end() && token.empty() == false) {
+    std::uint64_t index = 0;
+    const std::from_chars_result result = std::from_chars(token.data(),
+                                                          token.data() + token.size(), index);
+    if (result.ec == std::errc() && result.ptr == token.data() + token.size() &&
+        index < elements->second.size()) {
+      offset = elements->second[index];
+      pointer.remove_prefix(token.size() + 1);
+    }
+  }
+  return offset;
+}
+
+// Reads the sidecar of the given state file, unless it is missing or older than the state
+std::uint8_t jino::StateIndex::read(const std::filesystem::path& statePath) {
+  const std::filesystem::path path = getPath(statePath);
+  if (std::filesystem::exists(path) == false ||
+      std::filesystem::last_write_time(path) < std::filesystem::last_write_time(statePath)) {
+    return false;
+  }
+  MappedFile file(path);
+  const std::string_view bytes = file.view();
+  const nlohmann::json index = nlohmann::json::from_cbor(bytes.begin(), bytes.end());
+  index.at(consts::kIndexMembers).get_to(members_);
+  index.at(consts::kIndexElements).get_to(elements_);
+  return true;
+}
+
+void jino::StateIndex::write(const std::filesystem::path& statePath) const {
+  nlohmann::json index;
+  index[consts::kIndexMembers] = members_;
+  index[consts::kIndexElements] = elements_;
+  std::ofstream file(getPath(statePath), std::ios::binary);
+  if (file.is_open() == false) {
+    throw std::runtime_error("Could not open state index.");
+  }
+  nlohmann::json::to_cbor(index, file);
+  if (file.flush().fail() == true) {
+    throw std::runtime_error("Could not write state index.");
+  }
+}
@@ -0,0 +1,274 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include "StateParser.h"
+
+#include <cctype>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace {
+constexpr int kEOF = std::char_traits<char>::eof();
+
+std::uint8_t isTokenChar(const int c) {
+  return std::isalnum(c) || c == '-' || c == '+' || c == '.';
+}
+
+void appendUtf8(std::string& str, const std::uint32_t code) {
+  if (code < 0x80) {
+    str.push_back(static_cast<char>(code));
+  } else if (code < 0x800) {
+    str.push_back(static_cast<char>(0xC0 | (code >> 6)));
+    str.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+  } else if (code < 0x10000) {
+    str.push_back(static_cast<char>(0xE0 | (code >> 12)));
+    str.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+    str.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+  } else {
+    str.push_back(static_cast<char>(0xF0 | (code >> 18)));
+    str.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+    str.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+    str.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+  }
+}
+}  // anonymous namespace
+
+jino::StateParser::StateParser(std::streambuf& input) : input_(input), offset_(0) {}
+
+void jino::StateParser::finish() {
+  int c = peek();
+  if (c != kEOF) {
+    fail(c);
+  }
+}
+
+int jino::StateParser::peek() {
+  int c = input_.sgetc();
+  while (c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+    ++offset_;
+    c = input_.snextc();
+  }
+  return c;
+}
+
+char jino::StateParser::get() {
+  int c = peek();
+  if (c == kEOF) {
+    fail(c);
+  }
+  input_.sbumpc();
+  ++offset_;
+  return static_cast<char>(c);
+}
+
+void jino::StateParser::expect(const char expected) {
+  char c = get();
+  if (c != expected) {
+    fail(c);
+  }
+}
+
+std::uint8_t jino::StateParser::isEmpty(const char close) {
+  if (peek() == close) {
+    get();
+    return true;
+  }
+  return false;
+}
+
+std::uint8_t jino::StateParser::hasNext(const char close) {
+  char c = get();
+  if (c == ',') {
+    return true;
+  } else if (c != close) {
+    fail(c);
+  }
+  return false;
+}
+
+void jino::StateParser::readString(std::string& value) {
+  expect('"');
+  value.clear();
+  while (true) {
+    int c = input_.sbumpc();
+    ++offset_;
+    if (c == '"') {
+      return;
+    } else if (c == kEOF) {
+      fail(c);
+    } else if (c != '\\') {
+      value.push_back(static_cast<char>(c));
+      continue;
+    }
+    c = input_.sbumpc();
+    ++offset_;
+    switch (c) {
+      case '"':
+      case '\\':
+      case '/': value.push_back(static_cast<char>(c)); break;
+      case 'b': value.push_back('\b'); break;
+      case 'f': value.push_back('\f'); break;
+      case 'n': value.push_back('\n'); break;
+      case 'r': value.push_back('\r'); break;
+      case 't': value.push_back('\t'); break;
+      case 'u': {
+        auto readHex = [this]() {
+          std::uint32_t code = 0;
+          for (std::uint8_t i = 0; i < 4; ++i) {
+            int h = input_.sbumpc();
+            ++offset_;
+            if (std::isxdigit(h) == false) {
+              fail(h);
+            }
+            code = (code << 4) | static_cast<std::uint32_t>(std::isdigit(h) ? h - '0' :
+                                                            std::tolower(h) - 'a' + 10);
+          }
+          return code;
+        };
+        std::uint32_t code = readHex();
+        if (code >= 0xD800 && code <= 0xDBFF) {  // Surrogate pair
+          if (input_.sbumpc() != '\\' || input_.sbumpc() != 'u') {
+            fail(input_.sgetc());
+          }
+          offset_ += 2;
+          code = 0x10000 + ((code - 0xD800) << 10) + (readHex() - 0xDC00);
+        }
+        appendUtf8(value, code);
+        break;
+      }
+      default: fail(c);
+    }
+  }
+}
+
+void jino::StateParser::readToken() {
+  token_.clear();
+  int c = peek();
+  while (c != kEOF && isTokenChar(c)) {
+    token_.push_back(static_cast<char>(c));
+    ++offset_;
+    c = input_.snextc();
+  }
+  if (token_.empty() == true) {
+    fail(c);
+  }
+}
+
+bool jino::StateParser::readBool() {
+  readToken();
+  if (token_ == "true") {
+    return true;
+  } else if (token_ == "false") {
+    return false;
+  }
+  throw std::runtime_error("Invalid boolean \"" + token_ + "\" at offset " +
+                           std::to_string(offset_) + ".");
+}
+
+void jino::StateParser::readJson(nlohmann::json& j) {
+  switch (peek()) {
+    case '{': {
+      std::string key;
+      get();
+      j = nlohmann::json::object();
+      if (isEmpty('}') == false) {
+        do {
+          readString(key);
+          expect(':');
+          readJson(j[key]);
+        } while (hasNext('}') == true);
+      }
+      break;
+    }
+    case '[': {
+      get();
+      j = nlohmann::json::array();
+      if (isEmpty(']') == false) {
+        do {
+          j.emplace_back();
+          readJson(j.back());
+        } while (hasNext(']') == true);
+      }
+      break;
+    }
+    case '"': {
+      std::string str;
+      readString(str);
+      j = std::move(str);
+      break;
+    }
+    default: {
+      readToken();
+      if (token_ == "true" || token_ == "false") {
+        j = (token_ == "true");
+      } else if (token_ == kNull) {
+        j = nullptr;
+      } else if (token_.find_first_of(".eE") != std::string::npos) {
+        double value = 0;
+        parseNumber(value);
+        j = value;
+      } else if (token_.front() == '-') {
+        std::int64_t value = 0;
+        parseNumber(value);
+        j = value;
+      } else {
+        std::uint64_t value = 0;
+        parseNumber(value);
+        j = value;
+      }
+    }
+  }
+}
+
+void jino::StateParser::skipValue() {
+  std::uint64_t depth = 0;
+  do {
+    int c = peek();
+    if (c == '"') {
+      get();
+      do {
+        c = input_.sbumpc();
+        ++offset_;
+        if (c == '\\') {
+          input_.sbumpc();
+          ++offset_;
+        } else if (c == kEOF) {
+          fail(c);
+        }
+      } while (c != '"');
+    } else if (c == '{' || c == '[') {
+      get();
+      ++depth;
+    } else if (c == '}' || c == ']') {
+      get();
+      --depth;
+    } else if (c == ',' || c == ':') {
+      get();
+    } else {
+      readToken();
+    }
+  } while (depth != 0);
+}
+
+void jino::StateParser::fail(const int c) {
+  if (c == kEOF) {
+    throw std::runtime_error("Unexpected end of input at offset " + std::to_string(offset_) + ".");
+  }
+  throw std::runtime_error("Unexpected character \'" + std::string(1, static_cast<char>(c)) +
+                           "\' at offset " + std::to_string(offset_) + ".");
+}
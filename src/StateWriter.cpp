@@ -0,0 +1,105 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include "StateWriter.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace {
+constexpr std::string_view kSpaces = "                                ";
+constexpr std::string_view kHexDigits = "0123456789abcdef";
+}  // anonymous namespace
+
+jino::StateWriter::StateWriter(std::streambuf& output, const std::uint64_t indentSize,
+                               StateIndex* const index) :
+                               output_(output), indentSize_(indentSize), index_(index), depth_(0),
+                               count_(0) {}
+
+void jino::StateWriter::finish() {
+  if (output_.pubsync() != 0) {
+    throw std::runtime_error("Could not flush state output.");
+  }
+}
+
+void jino::StateWriter::put(const char c) {
+  if (output_.sputc(c) == std::char_traits<char>::eof()) {
+    throw std::runtime_error("Could not write state output.");
+  }
+  ++count_;
+}
+
+void jino::StateWriter::put(const std::string_view text) {
+  if (output_.sputn(text.data(), text.size()) != static_cast<std::streamsize>(text.size())) {
+    throw std::runtime_error("Could not write state output.");
+  }
+  count_ += text.size();
+}
+
+void jino::StateWriter::indent() {
+  for (std::uint64_t size = depth_ * indentSize_; size > 0;) {
+    const std::uint64_t count = std::min<std::uint64_t>(size, kSpaces.size());
+    put(kSpaces.substr(0, count));
+    size -= count;
+  }
+}
+
+// Escapes as nlohmann::json does with ensure_ascii off, multi-byte UTF-8 is passed through
+void jino::StateWriter::writeString(const std::string_view text) {
+  put('"');
+  std::uint64_t begin = 0;
+  for (std::uint64_t i = 0; i < text.size(); ++i) {
+    const unsigned char c = static_cast<unsigned char>(text[i]);
+    if (c >= 0x20 && c != '"' && c != '\\') {
+      continue;
+    }
+    put(text.substr(begin, i - begin));
+    begin = i + 1;
+    switch (c) {
+      case '"': put("\\\""); break;
+      case '\\': put("\\\\"); break;
+      case '\b': put("\\b"); break;
+      case '\f': put("\\f"); break;
+      case '\n': put("\\n"); break;
+      case '\r': put("\\r"); break;
+      case '\t': put("\\t"); break;
+      default: {
+        put("\\u00");
+        put(kHexDigits[c >> 4]);
+        put(kHexDigits[c & 0xF]);
+      }
+    }
+  }
+  put(text.substr(begin));
+  put('"');
+}
+
+// Nested lines of the dump are shifted to the current depth, newlines within strings are escaped
+void jino::StateWriter::writeJson(const nlohmann::json& j) {
+  const std::string text = j.dump(static_cast<int>(indentSize_));
+  std::uint64_t begin = 0;
+  for (std::uint64_t end = text.find('\n'); end != std::string::npos;
+       end = text.find('\n', begin)) {
+    put(std::string_view(text).substr(begin, end + 1 - begin));
+    indent();
+    begin = end + 1;
+  }
+  put(std::string_view(text).substr(begin));
+}
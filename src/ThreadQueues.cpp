@@ -17,6 +17,7 @@
 
 #include "ThreadQueues.h"
 
+#include <functional>
 #include <utility>
 #include <vector>
 
@@ -32,9 +33,8 @@ jino::ThreadQueues::~ThreadQueues() {
   }
   condition_.notify_all();
   for (auto& [queueId, thread] : activeThreads_) {
-    if (thread.joinable() && !joinedThreads_[queueId]) {
+    if (thread.joinable()) {
       thread.join();
-      joinedThreads_[queueId] = true;
     }
   }
 }
@@ -61,9 +61,6 @@ void jino::ThreadQueues::workerThread(std::uint64_t queueId) {
       } catch (...) {}
     }
   }
-  std::unique_lock<std::mutex> lock(queueMutex_);
-  joinedThreads_[queueId] = true;
-  condition_.notify_all();
 }
 
 void jino::ThreadQueues::stopThreads() {
@@ -80,23 +77,39 @@ void jino::ThreadQueues::stopThreads() {
 }
 
 void jino::ThreadQueues::stopThread(std::uint64_t queueId) {
+  std::thread thread;
   {
     std::unique_lock<std::mutex> lock(queueMutex_);
     if (stopFlags_[queueId]) {
       return;
     }
     stopFlags_[queueId] = true;
+    auto it = activeThreads_.find(queueId);
+    if (it != activeThreads_.end()) {
+      thread = std::move(it->second);  // Entry stays until joined so no second worker starts
+    }
   }
   condition_.notify_all();
-  if (activeThreads_.count(queueId)) {
-    if (activeThreads_[queueId].joinable() && !joinedThreads_[queueId]) {
-      activeThreads_[queueId].join();
-      joinedThreads_[queueId] = true;
-    }
-    if (joinedThreads_[queueId]) {
-      activeThreads_.erase(queueId);
-      stopFlags_.erase(queueId);
+  if (thread.joinable()) {
+    thread.join();
+  }
+  // Tasks enqueued after the worker drained its queue but before the entry is erased start no
+  // new worker, so they are run here in order until the queue stays empty
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(queueMutex_);
+      if (taskQueues_[queueId].empty()) {
+        activeThreads_.erase(queueId);
+        stopFlags_.erase(queueId);
+        return;
+      }
+      task = std::move(taskQueues_[queueId].front());
+      taskQueues_[queueId].pop();
     }
+    try {
+      task();
+    } catch (...) {}
   }
 }
 
@@ -104,7 +117,6 @@ void jino::ThreadQueues::restartThread(std::uint64_t queueId) {
   std::unique_lock<std::mutex> lock(queueMutex_);
   if (activeThreads_.find(queueId) == activeThreads_.end()) {
     stopFlags_[queueId] = false;
-    joinedThreads_[queueId] = false;
     activeThreads_[queueId] = std::thread(&ThreadQueues::workerThread, this, queueId);
   }
 }
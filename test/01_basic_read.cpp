@@ -23,7 +23,6 @@
 #include "Buffer.h"
 #include "Constants.h"
 #include "Data.h"
-#include "DatumBase.h"
 #include "JsonReader.h"
 
 std::uint8_t isStringInArray(const std::string str, std::array<std::string,
@@ -44,7 +43,7 @@ int main() {
   std::cout << "2. Validating read data..." << std::endl;
   assert(params.size() == jino::consts::kParamNames.size());
 
-  params.forEachDatum([&](const std::string&, jino::DatumBase* const) {
+  params.forEachDatum([&](const std::string& name, const jino::DataValue&) {
     assert(params.contains(name) == true);
     assert(isStringInArray(name, jino::consts::kParamNames));
   });
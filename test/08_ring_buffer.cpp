@@ -0,0 +1,110 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <netcdf>
+
+#include "Buffer.h"
+#include "Buffers.h"
+#include "Constants.h"
+#include "Data.h"
+#include "JsonReader.h"
+#include "NetCDFData.h"
+#include "Output.h"
+
+int main() {
+  std::cout << "1. Testing circular recording..." << std::endl;
+  const std::uint64_t dataSize = 5;
+  const std::uint64_t maxRecords = 12;
+  std::uint64_t t = 0;
+  auto tBuffer = jino::Buffer<std::uint64_t>("t", dataSize, t, jino::consts::eCircular);
+  for (t = 0; t < maxRecords; ++t) {
+    tBuffer.record();
+  }
+  assert(tBuffer.size() == dataSize);
+  assert(tBuffer.getCount() == dataSize);
+
+  std::cout << "2. Validating chronological slabs..." << std::endl;
+  std::vector<std::uint64_t> window;
+  std::uint64_t numSlabs = 0;
+  tBuffer.forEachSlab([&](const std::uint64_t start, const std::uint64_t count,
+                          const std::uint64_t* values) {
+    assert(start == window.size());
+    window.insert(window.end(), values, values + count);
+    ++numSlabs;
+  });
+  assert(numSlabs == 2);
+  assert(window.size() == dataSize);
+  for (std::uint64_t i = 0; i < dataSize; ++i) {
+    assert(window.at(i) == maxRecords - dataSize + i);
+  }
+
+  std::cout << "3. Testing overwritten reads..." << std::endl;
+  std::uint8_t isOverwritten = false;
+  try {
+    static_cast<void>(tBuffer.getNext());
+  } catch (const std::out_of_range&) {
+    isOverwritten = true;
+  }
+  assert(isOverwritten == true);
+
+  std::cout << "4. Testing linear overflow..." << std::endl;
+  std::uint64_t r = 0;
+  auto rBuffer = jino::Buffer<std::uint64_t>("r", dataSize, r);
+  for (r = 0; r < dataSize; ++r) {
+    rBuffer.record();
+  }
+  std::uint8_t isOutOfRange = false;
+  try {
+    rBuffer.record();
+  } catch (const std::out_of_range&) {
+    isOutOfRange = true;
+  }
+  assert(isOutOfRange == true);
+
+  std::cout << "5. Testing write of retained window..." << std::endl;
+  jino::Data attrs;
+  jino::JsonReader reader;
+  reader.readAttrs(attrs);
+
+  jino::Output output;
+  jino::NetCDFData data;
+  data.addDateToData(&attrs, output.getDate());
+  data.addDimension("dataSize", dataSize);
+
+  output.toFile(data);
+  output.waitForCompletion();
+
+  std::cout << "6. Validating written window..." << std::endl;
+  netCDF::NcFile file(output.getNetCDFPath(), netCDF::NcFile::read);
+  std::vector<std::uint64_t> tValues(dataSize);
+  std::vector<std::uint64_t> rValues(dataSize);
+  file.getVar("t").getVar({0}, {dataSize}, tValues.data());
+  file.getVar("r").getVar({0}, {dataSize}, rValues.data());
+  file.close();
+  for (std::uint64_t i = 0; i < dataSize; ++i) {
+    assert(tValues.at(i) == maxRecords - dataSize + i);  // Oldest retained record first
+    assert(rValues.at(i) == i);
+  }
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
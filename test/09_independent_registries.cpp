@@ -0,0 +1,91 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Buffer.h"
+#include "Buffers.h"
+#include "Constants.h"
+#include "Data.h"
+#include "JsonReader.h"
+#include "NetCDFData.h"
+#include "Output.h"
+
+void runModel(const std::uint64_t member, const std::uint64_t maxTimeStep,
+              const std::uint64_t samplingRate) {
+  jino::Buffers buffers;
+  jino::Output output(buffers);
+  jino::NetCDFData data;
+
+  const std::uint64_t dataSize = maxTimeStep / samplingRate + 1;
+  data.addDimension("dataSize", dataSize);
+
+  double y = 0;
+  std::uint64_t t = 0;
+  auto yBuffer = jino::Buffer<double>(buffers, "y", "model", dataSize, y);
+  auto tBuffer = jino::Buffer<std::uint64_t>(buffers, "t", "model", dataSize, t);
+
+  output.writeMetadata(data);
+  for (t = 0; t <= maxTimeStep; ++t) {
+    y = static_cast<double>(member * t);
+    if (t % samplingRate == 0) {
+      buffers.record();
+      output.writeDatums(data);
+    }
+  }
+  output.closeNetCDF();
+  output.waitForCompletion();
+  assert(yBuffer.getCount() == dataSize);
+  assert(yBuffer.at(dataSize - 1) == static_cast<double>(member * maxTimeStep));
+}
+
+int main() {
+  std::cout << "1. Testing independent registries..." << std::endl;
+  std::uint64_t x = 0;
+  jino::Buffers buffers;
+  auto globalBuffer = jino::Buffer<std::uint64_t>("x", 1, x);
+  auto localBuffer = jino::Buffer<std::uint64_t>(buffers, "x", 1, x);
+  std::uint64_t numLocal = 0;
+  buffers.forEachBuffer([&numLocal](const jino::BufferKey&, jino::BufferBase* const) {
+    ++numLocal;
+  });
+  assert(numLocal == 1);
+
+  std::cout << "2. Testing concurrent model instances..." << std::endl;
+  jino::Data params;
+  jino::JsonReader reader;
+  reader.readParams(params);
+  const std::uint64_t maxTimeStep = params.getValue<std::uint64_t>(jino::consts::kMaxTimeStep);
+  const std::uint64_t samplingRate = params.getValue<std::uint64_t>(jino::consts::kSamplingRate);
+
+  const std::uint64_t numMembers = 4;
+  std::vector<std::thread> members;
+  for (std::uint64_t member = 0; member < numMembers; ++member) {
+    members.emplace_back(runModel, member, maxTimeStep, samplingRate);
+  }
+  for (auto& member : members) {
+    member.join();
+  }
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
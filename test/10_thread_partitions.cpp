@@ -0,0 +1,118 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Buffer.h"
+#include "Buffers.h"
+#include "Constants.h"
+#include "Data.h"
+#include "JsonReader.h"
+#include "NetCDFData.h"
+#include "Output.h"
+
+int main() {
+  std::cout << "1. Testing partitioned recording..." << std::endl;
+  const std::uint64_t numThreads = 4;
+  const std::uint64_t cellsPerThread = 1000;
+  const std::uint64_t dataSize = numThreads * cellsPerThread;
+
+  jino::Buffers buffers;
+  double x = 0;
+  auto xBuffer = jino::Buffer<double>(buffers, "x", dataSize, x);
+  xBuffer.partition(numThreads);
+
+  std::vector<std::thread> workers;
+  for (std::uint64_t p = 0; p < numThreads; ++p) {
+    workers.emplace_back([&xBuffer, p]() {
+      for (std::uint64_t i = 0; i < cellsPerThread; ++i) {
+        xBuffer.setNext(p) = static_cast<double>(p * cellsPerThread + i);
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  assert(xBuffer.getCount() == dataSize);
+
+  std::cout << "2. Validating concatenated partitions..." << std::endl;
+  std::uint64_t next = 0;
+  xBuffer.forEachSlab([&next](const std::uint64_t start, const std::uint64_t count,
+                              const double* values) {
+    assert(start == next);
+    for (std::uint64_t i = 0; i < count; ++i) {
+      assert(values[i] == static_cast<double>(start + i));
+    }
+    next += count;
+  });
+  assert(next == dataSize);
+  assert(xBuffer.at(dataSize - 1) == static_cast<double>(dataSize - 1));
+
+  std::cout << "3. Testing unpartitioned recording is rejected..." << std::endl;
+  std::uint8_t isRejected = false;
+  try {
+    buffers.record();
+  } catch (const std::runtime_error&) {
+    isRejected = true;
+  }
+  assert(isRejected == true);
+
+  std::cout << "4. Testing partly filled partitions keep their place..." << std::endl;
+  double y = 0;
+  auto yBuffer = jino::Buffer<double>("y", dataSize, y);
+  yBuffer.partition(numThreads);
+  yBuffer.setNext(0) = 0.0;
+  yBuffer.setNext(2) = 2.0;
+  std::vector<std::uint64_t> starts;
+  yBuffer.forEachSlab([&starts](const std::uint64_t start, const std::uint64_t,
+                                const double*) {
+    starts.push_back(start);
+  });
+  assert(starts.size() == numThreads);
+  for (std::uint64_t p = 0; p < numThreads; ++p) {
+    assert(starts.at(p) == p * cellsPerThread);
+  }
+  assert(yBuffer.at(2 * cellsPerThread) == 2.0);
+  std::uint8_t isGap = false;
+  try {
+    static_cast<void>(yBuffer.at(1));
+  } catch (const std::out_of_range&) {
+    isGap = true;
+  }
+  assert(isGap == true);
+
+  std::cout << "5. Testing write of merged partitions..." << std::endl;
+  jino::Data attrs;
+  jino::JsonReader reader;
+  reader.readAttrs(attrs);
+
+  jino::Output output(buffers);
+  jino::NetCDFData data;
+  data.addDateToData(&attrs, output.getDate());
+  data.addDimension("dataSize", dataSize);
+
+  output.toFile(data);
+  output.waitForCompletion();
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,118 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <netcdf>
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Buffer.h"
+#include "Buffers.h"
+#include "Constants.h"
+#include "Data.h"
+#include "DictBuffer.h"
+#include "JsonReader.h"
+#include "NetCDFData.h"
+#include "Output.h"
+
+int main() {
+  std::cout << "1. Testing dictionary encoding..." << std::endl;
+  const std::uint64_t dataSize = 100;
+  const std::array<std::string, 3> states = {"idle", "running", "shut down"};
+  std::string status = states.at(0);
+  std::uint64_t t = 0;
+  auto statusBuffer = jino::DictBuffer("status", dataSize, status);
+  auto tBuffer = jino::Buffer<std::uint64_t>("t", dataSize, t);
+  for (t = 0; t < dataSize; ++t) {
+    status = states.at((t / 10) % states.size());
+    jino::Buffers::get().record();
+  }
+  assert(statusBuffer.getType() == jino::consts::eInt8);
+  assert(statusBuffer.getLabels().size() == states.size());
+  assert(statusBuffer.getCount() == dataSize);
+
+  std::cout << "2. Validating decoded records..." << std::endl;
+  for (std::uint64_t i = 0; i < dataSize; ++i) {
+    assert(statusBuffer.decode(statusBuffer.at(i)) == states.at((i / 10) % states.size()));
+  }
+
+  std::cout << "3. Testing write of codes and lookup table..." << std::endl;
+  jino::Data attrs;
+  jino::JsonReader reader;
+  reader.readAttrs(attrs);
+
+  jino::Output output;
+  jino::NetCDFData data;
+  data.addDateToData(&attrs, output.getDate());
+  data.addDimension("dataSize", dataSize);
+
+  output.toFile(data);
+  output.waitForCompletion();
+
+  std::cout << "4. Validating codes and lookup table..." << std::endl;
+  {
+    netCDF::NcFile file(output.getNetCDFPath(), netCDF::NcFile::read);
+    netCDF::NcVar var = file.getVar("status");
+    assert(var.getType().getName() == "byte");
+    std::vector<std::int8_t> codes(dataSize);
+    var.getVar({0}, {dataSize}, codes.data());
+    for (std::uint64_t i = 0; i < dataSize; ++i) {
+      assert(codes.at(i) == static_cast<std::int8_t>((i / 10) % states.size()));
+    }
+    const netCDF::NcVarAtt values = var.getAtt(jino::consts::kFlagValues);
+    assert(values.getType().getName() == "byte" && values.getAttLength() == states.size());
+    std::vector<std::int8_t> flags(states.size());
+    values.getValues(flags.data());
+    for (std::uint64_t code = 0; code < flags.size(); ++code) {
+      assert(flags.at(code) == static_cast<std::int8_t>(code));
+    }
+    std::string meanings;
+    var.getAtt(jino::consts::kFlagMeanings).getValues(meanings);
+    assert(meanings == "idle running shut_down");
+    file.close();
+  }
+
+  std::cout << "5. Testing write in a classic format..." << std::endl;
+  jino::Buffers buffers;
+  auto classicBuffer = jino::DictBuffer(buffers, "status", dataSize, status);
+  for (std::uint64_t i = 0; i < dataSize; ++i) {
+    status = states.at(i % states.size());
+    buffers.record();
+  }
+  jino::Output classicOutput(buffers);
+  classicOutput.setNetCDFFormat(jino::consts::eClassic);
+  jino::NetCDFData classicData;
+  classicData.addDimension("dataSize", dataSize);
+  classicOutput.toFile(classicData);
+  classicOutput.waitForCompletion();
+  {
+    netCDF::NcFile file(classicOutput.getNetCDFPath(), netCDF::NcFile::read);
+    std::vector<std::int8_t> codes(dataSize);
+    file.getVar("status").getVar({0}, {dataSize}, codes.data());
+    file.close();
+    for (std::uint64_t i = 0; i < dataSize; ++i) {
+      assert(classicBuffer.decode(codes.at(i)) == states.at(i % states.size()));
+    }
+  }
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
@@ -15,44 +15,61 @@
 * If not, see <https://www.gnu.org/licenses/>.                                                *
 **********************************************************************************************/
 
-#include "Datum.h"
-
+#include <cassert>
 #include <cstdint>
+#include <iostream>
 #include <string>
+#include <vector>
 
-#include "Types.h"
-
-template<class T> jino::Datum<T>::Datum(const T value): DatumBase(Types<T>::type), value_(value) {}
-
-template class jino::Datum<std::int8_t>;
-template class jino::Datum<std::int16_t>;
-template class jino::Datum<std::int32_t>;
-template class jino::Datum<std::int64_t>;
-template class jino::Datum<std::uint8_t>;
-template class jino::Datum<std::uint16_t>;
-template class jino::Datum<std::uint32_t>;
-template class jino::Datum<std::uint64_t>;
-template class jino::Datum<float>;
-template class jino::Datum<double>;
-template class jino::Datum<std::string>;
-
-template<class T>
-const std::string jino::Datum<T>::getValueStr() const {
-  return std::to_string(value_);
-}
+#include "nlohmann/json.hpp"
+
+#include "JsonReader.h"
+#include "StateMembers.h"
+
+using json = nlohmann::json;
+
+class Piston {
+ public:
+  double temperature_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Piston, temperature_)
+};
+
+class Engine {
+ public:
+  std::vector<Piston> pistons_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Engine, pistons_)
+};
+
+class Car {
+ public:
+  std::string make_;
+  std::string model_;
+  Engine engine_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Car, make_, model_, engine_)
+};
+
+class Garage {
+ public:
+  std::vector<Car> cars_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Garage, cars_)
+};
+
+int main() {
+  std::cout << "1. Testing sequential read..." << std::endl;
+  jino::JsonReader reader;
+  const json expected = reader.readState<Garage>();
+  assert(expected.at("cars_").empty() == false);
+
+  std::cout << "2. Testing parallel read..." << std::endl;
+  for (const std::uint64_t numThreads : {1, 2, 3, 64}) {
+    const json actual = reader.readStateParallel<Garage>(numThreads);
+    assert(actual == expected);
+  }
+  std::cout << "All Passed." << std::endl;
 
-template const std::string jino::Datum<std::int8_t>::getValueStr() const;
-template const std::string jino::Datum<std::int16_t>::getValueStr() const;
-template const std::string jino::Datum<std::int32_t>::getValueStr() const;
-template const std::string jino::Datum<std::int64_t>::getValueStr() const;
-template const std::string jino::Datum<std::uint8_t>::getValueStr() const;
-template const std::string jino::Datum<std::uint16_t>::getValueStr() const;
-template const std::string jino::Datum<std::uint32_t>::getValueStr() const;
-template const std::string jino::Datum<std::uint64_t>::getValueStr() const;
-template const std::string jino::Datum<float>::getValueStr() const;
-template const std::string jino::Datum<double>::getValueStr() const;
-
-template<>
-const std::string jino::Datum<std::string>::getValueStr() const {
-  return value_;
+  return 0;
 }
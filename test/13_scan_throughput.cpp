@@ -0,0 +1,105 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "nlohmann/json.hpp"
+
+#include "JsonScanner.h"
+
+using json = nlohmann::json;
+
+// Whether scanning the elements of the array fails, as nlohmann::json::parse does
+std::uint8_t isRejected(const std::string& text) {
+  std::uint8_t isScanRejected = false;
+  try {
+    jino::JsonScanner(text).forEachElement(0, [](const std::uint64_t, const std::uint64_t) {});
+  } catch (const std::runtime_error&) {
+    isScanRejected = true;
+  }
+  assert(isScanRejected == (json::accept(text) == false));
+  return isScanRejected;
+}
+
+double measureThroughput(const std::string& text, const std::function<void()>& function) {
+  double seconds = std::numeric_limits<double>::max();
+  for (std::uint64_t repeat = 0; repeat < 3; ++repeat) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    seconds = std::min(seconds, elapsed.count());
+  }
+  return static_cast<double>(text.size()) / seconds / 1e9;
+}
+
+int main() {
+  std::cout << "1. Creating state document..." << std::endl;
+  json cars = json::array();
+  for (std::uint64_t i = 0; i < 100000; ++i) {
+    json pistons = json::array();
+    for (std::uint64_t j = 0; j < 4; ++j) {
+      pistons.push_back({{"temperature_", 273.15 + static_cast<double>(i * j) / 7}});
+    }
+    cars.push_back({{"make_", "Make \"" + std::to_string(i) + "\" {[\\"},
+                    {"model_", "Model " + std::to_string(i)},
+                    {"engine_", {{"pistons_", pistons}}}});
+  }
+  const std::string text = json({{"cars_", cars}}).dump(2);
+
+  std::cout << "2. Testing structural scan..." << std::endl;
+  jino::JsonScanner scanner(text);
+  std::uint64_t end = 0;
+  const double scanRate = measureThroughput(text, [&]() { end = scanner.skipValue(0); });
+  assert(end == text.size());
+  std::uint64_t count = 0;
+  scanner.forEachMember(0, [&](const std::string& key, const std::uint64_t begin,
+                               const std::uint64_t) {
+    if (key == "cars_") {
+      scanner.forEachElement(begin, [&count](const std::uint64_t, const std::uint64_t) {
+        ++count;
+      });
+    }
+  });
+  assert(count == cars.size());
+
+  std::cout << "3. Comparing throughput..." << std::endl;
+  json document;
+  const double parseRate = measureThroughput(text, [&]() { document = json::parse(text); });
+  assert(document.at("cars_").size() == cars.size());
+  std::cout << "Document size:   " << text.size() << " bytes" << std::endl;
+  std::cout << "JsonScanner (" << jino::JsonScanner::getInstructionSet() << "): "
+            << scanRate << " GB/s" << std::endl;
+  std::cout << "nlohmann::json::parse: " << parseRate << " GB/s" << std::endl;
+
+  std::cout << "4. Testing malformed scalars are rejected..." << std::endl;
+  assert(isRejected(R"([true, false, null, 0, -12, 3.5, 1e9, -0.25E-3, "x", {}])") == false);
+  for (const std::string scalar : {"tru", "nul", "falsey", "1.2.3", "01", "-", "1.", ".5",
+                                   "1e", "+1", "0x1F", "NaN"}) {
+    assert(isRejected("[" + scalar + "]") == true);
+  }
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,96 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <cassert>
+#include <cstdint>
+#include <filesystem>  /// NOLINT
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "Constants.h"
+#include "JsonReader.h"
+#include "Output.h"
+#include "StateMembers.h"
+
+using json = nlohmann::json;
+
+class Piston {
+ public:
+  double temperature_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Piston, temperature_)
+};
+
+class Engine {
+ public:
+  std::vector<Piston> pistons_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Engine, pistons_)
+};
+
+class Car {
+ public:
+  std::string make_;
+  std::string model_;
+  Engine engine_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Car, make_, model_, engine_)
+};
+
+class Garage {
+ public:
+  std::vector<Car> cars_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Garage, cars_)
+};
+
+int main() {
+  std::cout << "1. Creating sample data..." << std::endl;
+  Garage garage;
+  for (std::uint64_t i = 0; i < 10000; ++i) {
+    Engine engine;
+    for (std::uint64_t j = 0; j < 4; ++j) {
+      engine.pistons_.emplace_back(static_cast<double>(i + 1) / static_cast<double>(j + 3));
+    }
+    const std::string name = std::to_string(i);
+    garage.cars_.emplace_back("Make" + name, "Model" + name, engine);
+  }
+  const json expected = garage;
+
+  std::cout << "2. Testing checkpoint formats..." << std::endl;
+  jino::Output output;
+  jino::JsonReader reader;
+  std::uintmax_t textSize = 0;
+  for (std::uint8_t format = 0; format < jino::consts::eNumberOfStateFormats; ++format) {
+    const std::filesystem::path path = output.writeState(garage, format);
+    assert(path.extension() == jino::consts::kStateExtensions.at(format));
+    assert(jino::JsonReader::getStateFormat(path) == format);
+    const json actual = reader.readState<Garage>(path);
+    assert(actual == expected);
+    if (format == jino::consts::eJSON) {
+      textSize = std::filesystem::file_size(path);
+    } else {
+      assert(std::filesystem::file_size(path) < textSize);
+    }
+  }
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,113 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "ChunkBuffer.h"
+#include "StateMembers.h"
+#include "StateWriter.h"
+
+using json = nlohmann::json;
+
+class Piston {
+ public:
+  double temperature_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Piston, temperature_)
+};
+
+class Engine {
+ public:
+  std::vector<Piston> pistons_;
+  std::map<std::string, std::uint64_t> serials_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Engine, pistons_, serials_)
+};
+
+class Car {
+ public:
+  std::string make_;
+  std::string model_;
+  Engine engine_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Car, make_, model_, engine_)
+};
+
+class Garage {
+ public:
+  std::vector<Car> cars_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Garage, cars_)
+};
+
+int main() {
+  std::cout << "1. Creating sample data..." << std::endl;
+  Garage garage;
+  for (std::uint64_t i = 0; i < 1000; ++i) {
+    Engine engine;
+    for (std::uint64_t j = 0; j < 4; ++j) {
+      engine.pistons_.emplace_back(static_cast<double>(i) / static_cast<double>(j + 1));
+    }
+    engine.serials_["block"] = i;
+    const std::string name = std::to_string(i);
+    garage.cars_.emplace_back("Make \"" + name + "\"\t\\", "Model\n" + name, engine);
+  }
+  garage.cars_.front().engine_.pistons_.front().temperature_ =
+      std::numeric_limits<double>::infinity();
+
+  std::cout << "2. Testing chunked output..." << std::endl;
+  const std::uint64_t chunkSize = 64;
+  std::string text;
+  std::uint64_t partialChunks = 0;
+  jino::ChunkBuffer buffer(chunkSize, [&](const std::string_view chunk) {
+    partialChunks += chunk.size() != chunkSize;
+    text.append(chunk);
+  });
+  jino::StateWriter writer(buffer);
+  writer.write(garage);
+  writer.finish();
+  assert(partialChunks <= 1);
+  assert(buffer.getCount() == text.size());
+
+  std::cout << "3. Validating streamed JSON..." << std::endl;
+  json expected = garage;
+  expected["cars_"][0]["engine_"]["pistons_"][0]["temperature_"] = nullptr;
+  assert(json::parse(text) == expected);
+
+  std::cout << "4. Testing an empty chunk is rejected..." << std::endl;
+  std::uint8_t isThrown = false;
+  try {
+    jino::ChunkBuffer empty(0, [](const std::string_view) {});
+  } catch (const std::invalid_argument&) {
+    isThrown = true;
+  }
+  assert(isThrown == true);
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
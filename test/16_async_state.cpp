@@ -0,0 +1,109 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <cassert>
+#include <cstdint>
+#include <filesystem>  /// NOLINT
+#include <future>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "JsonReader.h"
+#include "Output.h"
+#include "StateMembers.h"
+
+using json = nlohmann::json;
+
+class Piston {
+ public:
+  double temperature_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Piston, temperature_)
+};
+
+class Engine {
+ public:
+  std::vector<Piston> pistons_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Engine, pistons_)
+};
+
+class Car {
+ public:
+  std::string make_;
+  std::string model_;
+  Engine engine_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Car, make_, model_, engine_)
+};
+
+class Garage {
+ public:
+  std::vector<Car> cars_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Garage, cars_)
+};
+
+int main() {
+  std::cout << "1. Creating sample data..." << std::endl;
+  Garage garage;
+  for (std::uint64_t i = 0; i < 10000; ++i) {
+    Engine engine;
+    for (std::uint64_t j = 0; j < 4; ++j) {
+      engine.pistons_.emplace_back(static_cast<double>(j + 1));
+    }
+    const std::string name = std::to_string(i);
+    garage.cars_.emplace_back("Make" + name, "Model" + name, engine);
+  }
+  const json first = garage;
+
+  std::cout << "2. Testing snapshot isolation..." << std::endl;
+  jino::Output output;
+  std::future<std::filesystem::path> firstPath = output.writeStateAsync(garage);
+  for (Car& car : garage.cars_) {
+    car.engine_.pistons_.front().temperature_ = -1;
+  }
+  const json second = garage;
+  std::future<std::filesystem::path> secondPath = output.writeStateAsync(std::move(garage),
+                                                                         jino::consts::eCBOR);
+
+  std::cout << "3. Validating checkpoints..." << std::endl;
+  jino::JsonReader reader;
+  const std::filesystem::path path = firstPath.get();
+  assert(json(reader.readState<Garage>(path)) == first);
+  assert(json(reader.readState<Garage>(secondPath.get())) == second);
+
+  std::cout << "4. Testing failures reach the future..." << std::endl;
+  std::future<std::filesystem::path> failedPath = output.writeStateAsync(first,
+                                                                         jino::consts::eNetCDF);
+  std::uint8_t isFailed = false;
+  try {
+    static_cast<void>(failedPath.get());
+  } catch (const std::invalid_argument&) {
+    isFailed = true;  // Plain JSON has no declared members to write as NetCDF
+  }
+  assert(isFailed == true);
+  output.waitForCompletion();
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,119 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <cassert>
+#include <cstdint>
+#include <filesystem>  /// NOLINT
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "Constants.h"
+#include "JsonReader.h"
+#include "Output.h"
+#include "StateMembers.h"
+
+using json = nlohmann::json;
+
+class Piston {
+ public:
+  double temperature_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Piston, temperature_)
+};
+
+class Engine {
+ public:
+  std::vector<Piston> pistons_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Engine, pistons_)
+};
+
+class Car {
+ public:
+  std::string make_;
+  std::string model_;
+  Engine engine_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Car, make_, model_, engine_)
+};
+
+class Garage {
+ public:
+  std::vector<Car> cars_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Garage, cars_)
+};
+
+int main() {
+  std::cout << "1. Creating sample data..." << std::endl;
+  Garage garage;
+  for (std::uint64_t i = 0; i < 1000; ++i) {
+    Engine engine;
+    for (std::uint64_t j = 0; j < 4; ++j) {
+      engine.pistons_.emplace_back(static_cast<double>(j + 1));
+    }
+    const std::string name = std::to_string(i);
+    garage.cars_.emplace_back("Make" + name, "Model" + name, engine);
+  }
+
+  std::cout << "2. Testing delta checkpoints..." << std::endl;
+  const std::uint64_t baseInterval = 3;
+  jino::Output output;
+  jino::JsonReader reader;
+  std::uintmax_t baseSize = 0;
+  std::filesystem::path deltaPath;
+  for (std::uint64_t checkpoint = 0; checkpoint < 7; ++checkpoint) {
+    garage.cars_.at(checkpoint).engine_.pistons_.front().temperature_ = -1;
+    if (checkpoint == 4) {
+      garage.cars_.pop_back();
+    }
+    const std::filesystem::path path = output.writeStateDelta(garage, baseInterval);
+    if (checkpoint % baseInterval == 0) {
+      assert(path.extension() == jino::consts::kJSONExtension);
+      baseSize = std::filesystem::file_size(path);
+    } else {
+      assert(path.extension() == jino::consts::kDeltaExtension);
+      assert(std::filesystem::file_size(path) < baseSize / 100);
+      deltaPath = path;
+    }
+
+    std::cout << "3. Replaying checkpoint " << checkpoint << "..." << std::endl;
+    assert(json(reader.readState<Garage>(path)) == json(garage));
+  }
+
+  std::cout << "4. Testing upper case delta extension..." << std::endl;
+  std::filesystem::path upperPath = deltaPath;
+  upperPath.replace_extension(".DELTA");
+  std::filesystem::copy_file(deltaPath, upperPath);
+  assert(json(reader.readState<Garage>(upperPath)) == json(reader.readState<Garage>(deltaPath)));
+
+  std::cout << "5. Testing cyclic delta chain..." << std::endl;
+  const std::filesystem::path firstPath = deltaPath.parent_path() / "cycle_a.delta";
+  const std::filesystem::path secondPath = deltaPath.parent_path() / "cycle_b.delta";
+  std::ofstream(firstPath) << json({{jino::consts::kDeltaPrevious, "cycle_b.delta"},
+                                    {jino::consts::kDeltaPatch, json::array()}});
+  std::ofstream(secondPath) << json({{jino::consts::kDeltaPrevious, "cycle_a.delta"},
+                                     {jino::consts::kDeltaPatch, json::array()}});
+  assert(reader.readState<Garage>(firstPath).cars_.empty() == true);  // Rejected, not looped
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
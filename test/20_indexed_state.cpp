@@ -0,0 +1,120 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <cassert>
+#include <cstdint>
+#include <filesystem>  /// NOLINT
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "Constants.h"
+#include "JsonReader.h"
+#include "MappedFile.h"
+#include "Output.h"
+#include "StateIndex.h"
+#include "StateMembers.h"
+
+using json = nlohmann::json;
+
+class Piston {
+ public:
+  double temperature_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Piston, temperature_)
+};
+
+class Car {
+ public:
+  std::string make_;
+  std::vector<Piston> pistons_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Car, make_, pistons_)
+};
+
+class Garage {
+ public:
+  std::string name_;
+  std::vector<Car> cars_;
+  std::vector<std::uint64_t> spaces_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Garage, name_, cars_, spaces_)
+};
+
+int main() {
+  std::cout << "1. Creating sample data..." << std::endl;
+  Garage garage;
+  garage.name_ = "Garage";
+  for (std::uint64_t i = 0; i < 1000; ++i) {
+    std::vector<Piston> pistons;
+    for (std::uint64_t j = 0; j < 4; ++j) {
+      pistons.emplace_back(static_cast<double>(i + 1) / static_cast<double>(j + 3));
+    }
+    garage.cars_.emplace_back("Make" + std::to_string(i), pistons);
+    garage.spaces_.push_back(i * i);
+  }
+  jino::Output output;
+  jino::JsonReader reader;
+
+  for (const std::uint8_t isCompressed : {false, true}) {
+    std::cout << "2. Testing index offsets with compression " << static_cast<int>(isCompressed)
+              << "..." << std::endl;
+    const std::filesystem::path path = output.writeState(garage, jino::consts::eJSON,
+                                                         isCompressed, true);
+    assert(std::filesystem::exists(jino::StateIndex::getPath(path)) == true);
+    jino::StateIndex index;
+    assert(index.read(path) == true);
+    std::string_view pointer = "/cars_/998/pistons_/2";
+    const std::uint64_t offset = index.seek(pointer);
+    assert(pointer == "/pistons_/2");
+    if (isCompressed == false) {
+      jino::MappedFile file(path);
+      assert(file.view().substr(offset, 15) == "{\n      \"make_\"");
+      pointer = "/spaces_/999";
+      assert(file.view().substr(index.seek(pointer), 6) == "998001");
+      assert(pointer.empty() == true);
+    }
+    pointer = "/name_";
+    assert(index.seek(pointer) != 0 && pointer.empty() == true);
+    pointer = "/garage_/1";
+    assert(index.seek(pointer) == 0 && pointer == "/garage_/1");
+
+    std::cout << "3. Testing indexed reads..." << std::endl;
+    const auto [name, make, pistons, space] =
+        reader.readStateParts<std::string, std::string, std::vector<Piston>, std::uint64_t>(
+            {"/name_", "/cars_/7/make_", "/cars_/500/pistons_", "/spaces_/31"}, path);
+    assert(name == garage.name_);
+    assert(make == garage.cars_.at(7).make_);
+    assert(json(pistons) == json(garage.cars_.at(500).pistons_));
+    assert(space == garage.spaces_.at(31));
+    assert(reader.readStatePart<std::string>("/cars_/1000/make_", path).empty() == true);
+    assert(json(reader.readState<Garage>(path)) == json(garage));
+  }
+
+  std::cout << "4. Testing unindexed state..." << std::endl;
+  const std::filesystem::path path = output.writeState(garage);
+  assert(std::filesystem::exists(jino::StateIndex::getPath(path)) == false);
+  jino::StateIndex index;
+  assert(index.read(path) == false);
+  assert(reader.readStatePart<std::string>("/cars_/999/make_", path) == "Make999");
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,75 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <type_traits>
+
+#include "Constants.h"
+#include "Data.h"
+#include "JsonReader.h"
+#include "Params.h"
+
+static_assert(std::is_same_v<jino::ParamType<jino::consts::eMaxTimeSteps>, std::uint64_t>);
+static_assert(std::is_same_v<jino::ParamType<jino::consts::eWriteState>, std::uint8_t>);
+static_assert(std::is_same_v<jino::ParamType<jino::consts::eYMax>, float>);
+
+int main() {
+  jino::Data data;
+  jino::Params params;
+  jino::JsonReader reader;
+
+  std::cout << "1. Testing typed parameters against Data..." << std::endl;
+  reader.readParams(data);
+  reader.readParams(params);
+  assert(params.get<jino::consts::eMaxTimeSteps>() ==
+         data.getValue<std::uint64_t>(jino::consts::kMaxTimeStep));
+  assert(params.get<jino::consts::eSamplingRate>() ==
+         data.getValue<std::uint64_t>(jino::consts::kSamplingRate));
+  assert(params.get<jino::consts::eWriteState>() ==
+         data.getValue<std::uint8_t>(jino::consts::kWriteState));
+  assert(params.get<jino::consts::eYMin>() == data.getValue<float>(jino::consts::kYMin));
+  assert(params.get<jino::consts::eYMax>() == data.getValue<float>(jino::consts::kYMax));
+
+  std::cout << "2. Testing setting parameters..." << std::endl;
+  params.set<jino::consts::eYMax>(2.5f);
+  assert(params.get<jino::consts::eYMax>() == 2.5f);
+  params.set<jino::consts::eYMax>(data.getValue<float>(jino::consts::kYMax));
+
+  std::cout << "3. Comparing lookups..." << std::endl;
+  const std::uint64_t count = 1000000;
+  float dataSum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (std::uint64_t i = 0; i < count; ++i) {
+    dataSum += data.getValue<float>(jino::consts::kYMax);
+  }
+  const std::chrono::duration<double> dataTime = std::chrono::steady_clock::now() - start;
+  float paramsSum = 0;
+  start = std::chrono::steady_clock::now();
+  for (std::uint64_t i = 0; i < count; ++i) {
+    paramsSum += params.get<jino::consts::eYMax>();
+  }
+  const std::chrono::duration<double> paramsTime = std::chrono::steady_clock::now() - start;
+  assert(dataSum == paramsSum);
+  std::cout << "   Data: " << dataTime.count() << " s, Params: " << paramsTime.count() << " s"
+            << std::endl;
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
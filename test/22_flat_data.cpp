@@ -0,0 +1,77 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "Constants.h"
+#include "Data.h"
+
+int main() {
+  std::cout << "1. Testing value storage..." << std::endl;
+  jino::Data attrs;
+  attrs.reserve(4);
+  attrs.setValue<std::string>("title", "Flat attributes");
+  attrs.setValue<double>("scale_factor", 0.5);
+  attrs.setValue<std::int16_t>("_FillValue", -1);
+  attrs.setValue<std::uint8_t>("date", true);
+  assert(attrs.size() == 4);
+  assert(attrs.getValue<std::string>("title") == "Flat attributes");
+  assert(attrs.getValue<double>("scale_factor") == 0.5);
+  assert(attrs.getValue<std::int16_t>("_FillValue") == -1);
+  assert(attrs["date"].index() == jino::consts::eUInt8);
+  assert(attrs["title"].index() == jino::consts::eString);
+
+  std::cout << "2. Testing ordering by name..." << std::endl;
+  std::vector<std::string> names;
+  attrs.forEachDatum([&names](const std::string& name, const jino::DataValue&) {
+    names.push_back(name);
+  });
+  assert((names == std::vector<std::string>{"_FillValue", "date", "scale_factor", "title"}));
+
+  std::cout << "3. Testing errors..." << std::endl;
+  std::uint8_t isThrown = false;
+  try {
+    attrs.getValue<float>("scale_factor");
+  } catch (const std::runtime_error&) {
+    isThrown = true;
+  }
+  assert(isThrown == true);
+  isThrown = false;
+  try {
+    attrs.setValue<double>("scale_factor", 2.0);
+  } catch (const std::out_of_range&) {
+    isThrown = true;
+  }
+  assert(isThrown == true);
+
+  std::cout << "4. Testing modification..." << std::endl;
+  attrs["scale_factor"] = 2.0;
+  assert(attrs.getValue<double>("scale_factor") == 2.0);
+  attrs.erase("date");
+  assert(attrs.contains("date") == false && attrs.size() == 3);
+  attrs.clear();
+  assert(attrs.size() == 0);
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
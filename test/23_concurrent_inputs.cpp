@@ -0,0 +1,118 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <cassert>
+#include <cstdint>
+#include <exception>
+#include <filesystem>  /// NOLINT
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "Constants.h"
+#include "Data.h"
+#include "Inputs.h"
+#include "JsonReader.h"
+#include "NetCDFData.h"
+#include "Output.h"
+#include "StateMembers.h"
+
+using json = nlohmann::json;
+
+class Car {
+ public:
+  std::string make_;
+  std::vector<double> temperatures_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Car, make_, temperatures_)
+};
+
+class Garage {
+ public:
+  std::vector<Car> cars_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Garage, cars_)
+};
+
+int main() {
+  std::cout << "1. Creating sample data..." << std::endl;
+  Garage garage;
+  for (std::uint64_t i = 0; i < 10000; ++i) {
+    garage.cars_.emplace_back("Make" + std::to_string(i),
+                              std::vector<double>{0.5 * static_cast<double>(i), 1.0, 2.0});
+  }
+  jino::Output output;
+  const std::filesystem::path path = output.writeState(garage);
+
+  std::cout << "2. Testing concurrent reads..." << std::endl;
+  jino::JsonReader reader;
+  jino::Inputs<Garage> inputs = reader.readInputs<Garage>(path);
+  jino::Data attrs = inputs.attrs.get();
+  jino::Data params = inputs.params.get();
+  jino::NetCDFData data;  // Metadata is defined while the state may still be read
+  data.addDateToData(&attrs, output.getDate());
+  data.addData(&params);
+  data.addDimension("dataSize", params.getValue<std::uint64_t>(jino::consts::kSamplingRate));
+  const Garage state = inputs.state.get();
+
+  std::cout << "3. Comparing with sequential reads..." << std::endl;
+  jino::Data expectedAttrs;
+  jino::Data expectedParams;
+  reader.readAttrs(expectedAttrs);
+  reader.readParams(expectedParams);
+  assert(attrs.size() == expectedAttrs.size());
+  assert(params.size() == expectedParams.size());
+  expectedParams.forEachDatum([&params](const std::string& name, const jino::DataValue& value) {
+    assert(params[name] == value);
+  });
+  assert(json(state) == json(garage));
+
+  std::cout << "4. Testing malformed inputs reach the future..." << std::endl;
+  const std::filesystem::path paramsPath = jino::consts::kOutputDir + "malformed.json";
+  std::ofstream(paramsPath) << "{\"samplingRate\": ";
+  jino::Inputs<Garage> malformed =
+      reader.readInputs<Garage>(path, jino::consts::kInputDir + jino::consts::kAttrsFile,
+                                paramsPath);
+  std::uint8_t isRethrown = false;
+  try {
+    static_cast<void>(malformed.params.get());
+  } catch (const std::exception&) {
+    isRethrown = true;
+  }
+  std::filesystem::remove(paramsPath);
+  assert(isRethrown == true);
+  assert(malformed.attrs.get().size() == expectedAttrs.size());
+  static_cast<void>(malformed.state.get());
+
+  std::cout << "5. Testing a missing state reaches the future..." << std::endl;
+  jino::Inputs<Garage> missing = reader.readInputs<Garage>(jino::consts::kOutputDir +
+                                                           "missing.json");
+  isRethrown = false;
+  try {
+    static_cast<void>(missing.state.get());
+  } catch (const std::exception&) {
+    isRethrown = true;
+  }
+  assert(isRethrown == true);
+  assert(missing.params.get().size() == expectedParams.size());
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,110 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <cassert>
+#include <cstdint>
+#include <filesystem>  /// NOLINT
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "Constants.h"
+#include "JsonReader.h"
+#include "Output.h"
+#include "StateMembers.h"
+
+using json = nlohmann::json;
+
+class Piston {
+ public:
+  double temperature_;
+  std::uint8_t isFiring_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Piston, temperature_, isFiring_)
+};
+
+class Engine {
+ public:
+  std::vector<Piston> pistons_;
+  std::vector<double> pressures_;
+  bool isRunning_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Engine, pistons_, pressures_, isRunning_)
+};
+
+class Car {
+ public:
+  std::string make_;
+  std::uint64_t mileage_;
+  Engine engine_;
+  std::vector<std::vector<std::int32_t>> services_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Car, make_, mileage_, engine_, services_)
+};
+
+class Garage {
+ public:
+  std::string name_;
+  std::vector<Car> cars_;
+  std::vector<std::string> staff_;
+  std::map<std::string, float> prices_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Garage, name_, cars_, staff_, prices_)
+};
+
+int main() {
+  std::cout << "1. Creating sample data..." << std::endl;
+  Garage garage;
+  garage.name_ = "Garage";
+  garage.staff_ = {"Ada", "Grace"};
+  garage.prices_ = {{"service", 99.5f}, {"tyres", 250.0f}};
+  for (std::uint64_t i = 0; i < 100; ++i) {
+    Car car;
+    car.make_ = "Make" + std::to_string(i);
+    car.mileage_ = i * 1000000000000ULL;
+    for (std::uint64_t j = 0; j < i % 5; ++j) {
+      car.engine_.pistons_.push_back({static_cast<double>(i) / static_cast<double>(j + 3),
+                                      static_cast<std::uint8_t>(j % 2)});
+      car.engine_.pressures_.push_back(0.1 * static_cast<double>(j));
+      car.services_.push_back(std::vector<std::int32_t>(j, static_cast<std::int32_t>(i)));
+    }
+    car.engine_.isRunning_ = i % 3 == 0;
+    garage.cars_.push_back(car);
+  }
+  jino::Output output;
+  jino::JsonReader reader;
+
+  for (const std::uint8_t isCompressed : {false, true}) {
+    std::cout << "2. Testing NetCDF state with compression " << static_cast<int>(isCompressed)
+              << "..." << std::endl;
+    const std::filesystem::path path = output.writeState(garage, jino::consts::eNetCDF,
+                                                         isCompressed);
+    assert(path.extension() == jino::consts::kNCExtension);
+    assert(jino::JsonReader::getStateFormat(path) == jino::consts::eNetCDF);
+    assert(json(reader.readState<Garage>(path)) == json(garage));
+  }
+
+  std::cout << "3. Testing empty state..." << std::endl;
+  const std::filesystem::path path = output.writeState(Garage{}, jino::consts::eNetCDF);
+  assert(json(reader.readState<Garage>(path)) == json(Garage{}));
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,114 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <cassert>
+#include <cstdint>
+#include <filesystem>  /// NOLINT
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <netcdf>
+
+#include "Buffer.h"
+#include "Buffers.h"
+#include "Constants.h"
+#include "DictBuffer.h"
+#include "NetCDFData.h"
+#include "Output.h"
+
+const std::uint64_t kRecords = 5;
+
+std::string getPhase(const std::uint64_t t) {
+  return t < 3 ? "spin up" : t < 8 ? "model run" : "spin down";  // Blanks read back as '_'
+}
+
+// Runs one leg of a model, appending to an existing file when given one
+std::filesystem::path runLeg(const std::uint64_t firstStep, const std::filesystem::path& path) {
+  jino::Buffers buffers;
+  jino::Output output(buffers);
+  jino::NetCDFData data;
+  data.addDimension("time", kRecords, true);  // Unlimited, so the file can grow on resuming
+
+  double y = 0;
+  auto yBuffer = jino::Buffer<double>(buffers, "y", "model", kRecords, y);
+
+  std::string phase;
+  auto phaseBuffer = jino::DictBuffer(buffers, "phase", "model", kRecords, phase);
+
+  if (path.empty() == false) {
+    output.resumeNetCDF(path);
+  }
+  std::uint64_t z = 0;  // Attached after resuming, so it is carried on when first written
+  auto zBuffer = jino::Buffer<std::uint64_t>(buffers, "z", kRecords, z);
+  output.writeMetadata(data);
+  for (std::uint64_t t = firstStep; t < firstStep + kRecords; ++t) {
+    y = static_cast<double>(t) * 0.5;
+    z = t;
+    phase = getPhase(t);
+    buffers.record();
+    output.writeDatums(data);
+  }
+  output.waitForCompletion();
+  const std::filesystem::path written = output.getNetCDFPath();
+  output.closeNetCDF();
+  output.waitForCompletion();
+  return written;
+}
+
+int main() {
+  std::cout << "1. Writing the first leg..." << std::endl;
+  const std::filesystem::path path = runLeg(0, {});
+  assert(path.empty() == false);
+
+  std::cout << "2. Resuming into the same file..." << std::endl;
+  assert(runLeg(kRecords, path) == path);
+
+  std::cout << "3. Validating appended records..." << std::endl;
+  netCDF::NcFile file(path, netCDF::NcFile::read);
+  netCDF::NcVar var = file.getGroup("model").getVar("y");
+  assert(var.getDim(0).getSize() == 2 * kRecords);
+  std::vector<double> values(2 * kRecords);
+  var.getVar({0}, {values.size()}, values.data());
+  for (std::uint64_t t = 0; t < values.size(); ++t) {
+    assert(values[t] == static_cast<double>(t) * 0.5);
+  }
+
+  netCDF::NcVar zVar = file.getVar("z");
+  assert(zVar.getDim(0).getSize() == 2 * kRecords);
+  std::vector<std::uint64_t> steps(2 * kRecords);
+  zVar.getVar({0}, {steps.size()}, steps.data());
+  for (std::uint64_t t = 0; t < steps.size(); ++t) {
+    assert(steps[t] == t);
+  }
+
+  std::cout << "4. Validating codes carried on from the file..." << std::endl;
+  netCDF::NcVar phaseVar = file.getGroup("model").getVar("phase");
+  std::string meanings;
+  phaseVar.getAtt(jino::consts::kFlagMeanings).getValues(meanings);
+  assert(meanings == "spin_up model_run spin_down");  // Both legs share "model run"
+  const std::vector<std::string> phases = {"spin up", "model run", "spin down"};
+  std::vector<std::int8_t> codes(2 * kRecords);
+  phaseVar.getVar({0}, {codes.size()}, codes.data());
+  for (std::uint64_t t = 0; t < codes.size(); ++t) {
+    assert(phases.at(static_cast<std::uint8_t>(codes[t])) == getPhase(t));
+  }
+  file.close();
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
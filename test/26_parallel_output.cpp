@@ -0,0 +1,153 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <mpi.h>
+#include <netcdf.h>
+
+#include <cassert>
+#include <cstdint>
+#include <filesystem>  /// NOLINT
+#include <iostream>
+#include <vector>
+
+#include "Buffer.h"
+#include "Buffers.h"
+#include "NetCDFData.h"
+#include "ParallelWriter.h"
+
+// Run with several ranks, e.g. mpirun -np 4
+int main(int argc, char** argv) {
+  MPI_Init(&argc, &argv);
+  std::int32_t rank = 0;
+  std::int32_t size = 0;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  {
+    if (rank == 0) {
+      std::cout << "1. Recording uneven subdomains..." << std::endl;
+    }
+    jino::Buffers buffers;
+    const std::uint64_t numCells = rank + 1;
+    double x = 0;
+    std::int32_t cell = 0;
+    auto xBuffer = jino::Buffer<double>(buffers, "x", "domain", numCells, x);
+    auto cellBuffer = jino::Buffer<std::int32_t>(buffers, "cell", numCells, cell);
+    for (std::uint64_t i = 0; i < numCells; ++i) {
+      x = rank * 100.0 + static_cast<double>(i);
+      cell = rank;
+      buffers.record();
+    }
+
+    if (rank == 0) {
+      std::cout << "2. Writing one shared file..." << std::endl;
+    }
+    jino::Data attrs;
+    attrs.setValue<std::int32_t>("ranks", size);
+    jino::NetCDFData data;
+    data.addData(&attrs);
+    jino::ParallelWriter writer("parallel", buffers, MPI_COMM_WORLD);
+    writer.toFile(data, "cells");
+    writer.closeFile();
+    assert(writer.getOffset() == static_cast<std::uint64_t>(rank * (rank + 1) / 2));
+
+    if (rank == 0) {
+      std::cout << "3. Validating subdomain placement..." << std::endl;
+      const std::uint64_t numTotal = size * (size + 1) / 2;
+      std::int32_t fileId = 0;
+      std::int32_t groupId = 0;
+      std::int32_t varId = 0;
+      assert(nc_open(writer.getPath().c_str(), NC_NOWRITE, &fileId) == NC_NOERR);
+      assert(nc_inq_grp_ncid(fileId, "domain", &groupId) == NC_NOERR);
+      assert(nc_inq_varid(groupId, "x", &varId) == NC_NOERR);
+      std::vector<double> xs(numTotal);
+      const std::size_t start = 0;
+      const std::size_t count = numTotal;
+      assert(nc_get_vara(groupId, varId, &start, &count, xs.data()) == NC_NOERR);
+      assert(nc_inq_varid(fileId, "cell", &varId) == NC_NOERR);
+      std::vector<std::int32_t> cells(numTotal);
+      assert(nc_get_vara(fileId, varId, &start, &count, cells.data()) == NC_NOERR);
+      nc_close(fileId);
+      std::uint64_t index = 0;
+      for (std::int32_t owner = 0; owner < size; ++owner) {
+        for (std::int32_t i = 0; i <= owner; ++i) {
+          assert(xs[index] == owner * 100.0 + static_cast<double>(i));
+          assert(cells[index] == owner);
+          ++index;
+        }
+      }
+      std::filesystem::remove(writer.getPath());
+    }
+
+    if (rank == 0) {
+      std::cout << "4. Testing one rank's rejection is shared..." << std::endl;
+    }
+    std::int32_t extra = 0;
+    auto extraBuffer = jino::Buffer<std::int32_t>(buffers, "extra", numCells + 1, extra);
+    const std::uint64_t numExtra = rank == size - 1 ? numCells + 1 : numCells;
+    for (std::uint64_t i = 0; i < numExtra; ++i) {
+      extraBuffer.record();  // Unequally filled on the last rank only
+    }
+    jino::ParallelWriter rejected("rejected", buffers, MPI_COMM_WORLD);
+    std::uint8_t isRejected = false;
+    try {
+      rejected.toFile(data, "cells");
+    } catch (const std::exception&) {
+      isRejected = true;
+    }
+    rejected.closeFile();
+    assert(isRejected == true);
+    if (rank == 0) {
+      std::filesystem::remove(rejected.getPath());
+    }
+
+    if (rank == 0) {
+      std::cout << "5. Testing partitions keep their place..." << std::endl;
+    }
+    jino::Buffers partitioned;
+    double y = 0;
+    auto yBuffer = jino::Buffer<double>(partitioned, "y", 4, y);
+    yBuffer.partition(2);
+    yBuffer.setNext(0) = rank * 100.0;  // Slot 1 is left as a gap
+    yBuffer.setNext(1) = rank * 100.0 + 2.0;
+    yBuffer.setNext(1) = rank * 100.0 + 3.0;
+    jino::ParallelWriter gapped("gapped", partitioned, MPI_COMM_WORLD);
+    gapped.toFile(data, "cells");
+    gapped.closeFile();
+    assert(gapped.getOffset() == static_cast<std::uint64_t>(rank * 4));
+    if (rank == 0) {
+      std::int32_t fileId = 0;
+      std::int32_t varId = 0;
+      assert(nc_open(gapped.getPath().c_str(), NC_NOWRITE, &fileId) == NC_NOERR);
+      assert(nc_inq_varid(fileId, "y", &varId) == NC_NOERR);
+      std::vector<double> ys(4 * size);
+      const std::size_t start = 0;
+      const std::size_t count = ys.size();
+      assert(nc_get_vara(fileId, varId, &start, &count, ys.data()) == NC_NOERR);
+      nc_close(fileId);
+      for (std::int32_t owner = 0; owner < size; ++owner) {
+        assert(ys[4 * owner] == owner * 100.0);
+        assert(ys[4 * owner + 2] == owner * 100.0 + 2.0);
+        assert(ys[4 * owner + 3] == owner * 100.0 + 3.0);
+      }
+      std::filesystem::remove(gapped.getPath());
+      std::cout << "All Passed." << std::endl;
+    }
+  }
+  MPI_Finalize();
+
+  return 0;
+}
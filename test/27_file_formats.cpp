@@ -0,0 +1,127 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <cassert>
+#include <cstdint>
+#include <filesystem>  /// NOLINT
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include <netcdf>
+
+#include "Buffer.h"
+#include "Buffers.h"
+#include "Constants.h"
+#include "NetCDFData.h"
+#include "NetCDFFile.h"
+#include "Output.h"
+
+const std::uint64_t kRecords = 8;
+
+std::filesystem::path writeSeries(const std::uint8_t format) {
+  jino::Buffers buffers;
+  jino::Output output(buffers);
+  jino::NetCDFData data;
+  data.addDimension("time", kRecords);
+
+  double y = 0;
+  std::int32_t n = 0;
+  auto yBuffer = jino::Buffer<double>(buffers, "y", "model", kRecords, y);
+  auto nBuffer = jino::Buffer<std::int32_t>(buffers, "n", kRecords, n);
+
+  output.setNetCDFFormat(format);
+  output.writeMetadata(data);
+  for (std::uint64_t t = 0; t < kRecords; ++t) {
+    y = static_cast<double>(t) * 0.25;
+    n = static_cast<std::int32_t>(t);
+    buffers.record();
+    output.writeDatums(data);
+  }
+  output.waitForCompletion();
+  const std::filesystem::path path = output.getNetCDFPath();
+  output.closeNetCDF();
+  output.waitForCompletion();
+  return path;
+}
+
+int main() {
+  std::cout << "1. Testing each file format..." << std::endl;
+  for (std::uint8_t format = 0; format < jino::consts::eNumberOfFileFormats; ++format) {
+    const std::filesystem::path path = writeSeries(format);
+    netCDF::NcFile file(path, netCDF::NcFile::read);
+    netCDF::NcVar yVar;
+    if (format == jino::consts::eNetCDF4) {
+      yVar = file.getGroup("model").getVar("y");
+    } else {  // Groups are flattened into the variable names
+      assert(file.getGroup("model").isNull() == true);
+      yVar = file.getVar("model" + jino::consts::kGroupSeparator + "y");
+    }
+    netCDF::NcVar nVar = file.getVar("n");
+    assert(yVar.isNull() == false && nVar.isNull() == false);
+    std::vector<double> ys(kRecords);
+    std::vector<std::int32_t> ns(kRecords);
+    yVar.getVar({0}, {kRecords}, ys.data());
+    nVar.getVar({0}, {kRecords}, ns.data());
+    for (std::uint64_t t = 0; t < kRecords; ++t) {
+      assert(ys[t] == static_cast<double>(t) * 0.25);
+      assert(ns[t] == static_cast<std::int32_t>(t));
+    }
+    file.close();
+  }
+
+  std::cout << "2. Testing unsupported types..." << std::endl;
+  const std::filesystem::path path = jino::consts::kOutputDir + "formats" +
+                                     jino::consts::kNCExtension;
+  jino::NetCDFFile classic(path, jino::consts::eClassic);
+  classic.addDimension("time", kRecords);
+  std::uint8_t isThrown = false;
+  try {
+    classic.addVariable("count", "uint64", "time");
+  } catch (const std::invalid_argument&) {
+    isThrown = true;
+  }
+  assert(isThrown == true);
+  classic.addVariable("count", "int", "time");
+  assert(classic.hasGroups() == false);
+  classic.close();
+
+  jino::NetCDFFile cdf5(path, jino::consts::eCDF5);
+  cdf5.addDimension("time", kRecords);
+  cdf5.addVariable("count", "uint64", "time");
+  isThrown = false;
+  try {
+    cdf5.addVariable("name", "string", "time");
+  } catch (const std::invalid_argument&) {
+    isThrown = true;
+  }
+  assert(isThrown == true);
+  cdf5.close();
+
+  std::cout << "3. Testing an unknown format..." << std::endl;
+  jino::Output output;
+  isThrown = false;
+  try {
+    output.setNetCDFFormat(jino::consts::eNumberOfFileFormats);
+  } catch (const std::out_of_range&) {
+    isThrown = true;
+  }
+  assert(isThrown == true);
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,131 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <cassert>
+#include <cstdint>
+#include <filesystem>  /// NOLINT
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <netcdf>
+
+#include "Buffer.h"
+#include "Buffers.h"
+#include "Constants.h"
+#include "NetCDFData.h"
+#include "NetCDFFile.h"
+#include "Output.h"
+
+const std::uint64_t kRecords = 100;
+
+std::filesystem::path writeSeries(const std::uint64_t memoryCap) {
+  jino::Buffers buffers;
+  jino::Output output(buffers);
+  jino::NetCDFData data;
+  data.addDimension("time", kRecords);
+
+  double y = 0;
+  auto yBuffer = jino::Buffer<double>(buffers, "y", "model", kRecords, y);
+
+  output.setNetCDFDiskless(memoryCap);
+  output.writeMetadata(data);
+  for (std::uint64_t t = 0; t < kRecords; ++t) {
+    y = static_cast<double>(t) / 8.0;
+    buffers.record();
+    output.writeDatums(data);
+  }
+  output.waitForCompletion();
+  const std::filesystem::path path = output.getNetCDFPath();
+  output.closeNetCDF();
+  output.waitForCompletion();
+  return path;
+}
+
+// Writes two whole buffers at once, the second outgrowing the cap left by the first
+std::filesystem::path writeBuffers(const std::uint64_t memoryCap) {
+  jino::Buffers buffers;
+  jino::Output output(buffers);
+  jino::NetCDFData data;
+  data.addDimension("time", kRecords);
+
+  double y = 0;
+  double z = 0;
+  auto yBuffer = jino::Buffer<double>(buffers, "y", "model", kRecords, y);
+  auto zBuffer = jino::Buffer<double>(buffers, "z", "model", kRecords, z);
+  for (std::uint64_t t = 0; t < kRecords; ++t) {
+    y = static_cast<double>(t) / 8.0;
+    z = -y;
+    buffers.record();
+  }
+
+  output.setNetCDFDiskless(memoryCap);
+  output.toFile(data);
+  output.waitForCompletion();
+  return output.getNetCDFPath();
+}
+
+void validateSeries(const std::filesystem::path& path) {
+  netCDF::NcFile file(path, netCDF::NcFile::read);
+  std::vector<double> ys(kRecords);
+  file.getGroup("model").getVar("y").getVar({0}, {kRecords}, ys.data());
+  for (std::uint64_t t = 0; t < kRecords; ++t) {
+    assert(ys[t] == static_cast<double>(t) / 8.0);
+  }
+  file.close();
+}
+
+int main() {
+  std::cout << "1. Testing memory accounting..." << std::endl;
+  const std::filesystem::path path = jino::consts::kOutputDir + "diskless" +
+                                     jino::consts::kNCExtension;
+  {
+    jino::NetCDFFile file(path, jino::consts::eNetCDF4, true);
+    assert(file.isDiskless() == true);
+    file.addDimension("time", kRecords);
+    file.addVariable("y", "double", "time");
+    for (std::uint64_t t = 0; t < kRecords; ++t) {
+      file.addDatum<double>("y", t, static_cast<double>(t));
+    }
+    assert(file.getBytesWritten() == kRecords * sizeof(double));
+    file.addVariable("name", "string", "time");  // Strings count their characters
+    const std::vector<std::string> names = {std::string(1000, 'a'), "b"};
+    file.addDatum<std::string>("name", 0, names.front());
+    file.addData<std::string>("name", 1, 2, names.data());
+    assert(file.getBytesWritten() == kRecords * sizeof(double) + 2001);
+  }
+
+  std::cout << "2. Testing a run held in memory..." << std::endl;
+  validateSeries(writeSeries(jino::consts::kDisklessMemoryCap));
+
+  std::cout << "3. Testing the fall back to disk..." << std::endl;
+  validateSeries(writeSeries(10 * sizeof(double)));
+
+  std::cout << "4. Testing the fall back within one write..." << std::endl;
+  const std::filesystem::path written = writeBuffers(kRecords * sizeof(double) + 1);
+  validateSeries(written);
+  netCDF::NcFile file(written, netCDF::NcFile::read);
+  std::vector<double> zs(kRecords);
+  file.getGroup("model").getVar("z").getVar({0}, {kRecords}, zs.data());
+  file.close();
+  for (std::uint64_t t = 0; t < kRecords; ++t) {
+    assert(zs[t] == -static_cast<double>(t) / 8.0);
+  }
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,132 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <netcdf.h>
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Buffer.h"
+#include "Buffers.h"
+#include "Constants.h"
+#include "Data.h"
+#include "JsonReader.h"
+#include "NetCDFData.h"
+#include "NetCDFFile.h"
+#include "NetCDFTuning.h"
+#include "Output.h"
+
+// The 07_full_parallel workload without its simulated model time
+double measureSeconds(const jino::NetCDFTuning& tuning, const jino::Data& attrs,
+                      jino::Data& params) {
+  const std::uint64_t maxTimeStep = params.getValue<std::uint64_t>(jino::consts::kMaxTimeStep);
+  const std::uint64_t samplingRate = params.getValue<std::uint64_t>(jino::consts::kSamplingRate);
+  const std::uint64_t dataSize = maxTimeStep / samplingRate + 1;
+
+  double seconds = std::numeric_limits<double>::max();
+  for (std::uint64_t repeat = 0; repeat < 3; ++repeat) {
+    jino::Buffers buffers;
+    jino::Output output(buffers);
+    jino::NetCDFData data;
+    jino::Data runAttrs = attrs;  // The date flag is replaced by the date itself
+    data.addDateToData(&runAttrs, output.getDate());
+    data.addData(&params);
+    data.addDimension("dataSize", dataSize);
+
+    double y = 0;
+    std::uint64_t t = 0;
+    std::uint64_t r = 1;
+    std::vector<std::unique_ptr<jino::Buffer<double>>> yBuffers;
+    std::vector<std::unique_ptr<jino::Buffer<std::uint64_t>>> tBuffers;
+    for (std::uint64_t group = 1; group <= 10; ++group) {
+      const std::string index = (group < 10 ? "0" : "") + std::to_string(group);
+      yBuffers.push_back(std::make_unique<jino::Buffer<double>>(buffers, "y", "group" + index,
+                                                                dataSize, y));
+      tBuffers.push_back(std::make_unique<jino::Buffer<std::uint64_t>>(buffers, "t",
+                                                                       "group" + index,
+                                                                       dataSize, t));
+      tBuffers.push_back(std::make_unique<jino::Buffer<std::uint64_t>>(buffers, "r" + index,
+                                                                       dataSize, r));
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    output.setNetCDFTuning(tuning);
+    output.writeMetadata(data);
+    for (t = 0; t <= maxTimeStep; ++t) {
+      y = static_cast<double>(t) / static_cast<double>(maxTimeStep);
+      if (t % samplingRate == 0) {
+        buffers.record();
+        output.writeDatums(data);
+        r = r * 2;
+      }
+    }
+    output.closeNetCDF();
+    output.waitForCompletion();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    seconds = std::min(seconds, elapsed.count());
+  }
+  return seconds;
+}
+
+int main() {
+  std::size_t size = 0;
+  std::size_t slots = 0;
+  float preemption = 0;
+  assert(nc_get_chunk_cache(&size, &slots, &preemption) == NC_NOERR);
+
+  std::cout << "1. Reading the tuning profile..." << std::endl;
+  jino::JsonReader reader;
+  jino::NetCDFTuning tuning;
+  reader.readTuning(tuning);
+  assert(tuning.isFilled == false);
+  assert(tuning.cacheSize == 67108864);
+  jino::NetCDFTuning defaults;
+  reader.readTuning(defaults, jino::consts::kInputDir + "missing.json");
+  assert(defaults.isFilled == true && defaults.cacheSize == 0);
+
+  std::cout << "2. Comparing output times..." << std::endl;
+  jino::Data attrs;
+  jino::Data params;
+  reader.readAttrs(attrs);
+  reader.readParams(params);
+  const double defaultSeconds = measureSeconds(defaults, attrs, params);
+  const double tunedSeconds = measureSeconds(tuning, attrs, params);
+  std::cout << "Default profile: " << defaultSeconds << " s" << std::endl;
+  std::cout << "Tuned profile:   " << tunedSeconds << " s" << std::endl;
+  std::cout << "Speed-up:        " << defaultSeconds / tunedSeconds << "x" << std::endl;
+
+  std::cout << "3. Testing the default profile restores netCDF's cache..." << std::endl;
+  std::size_t tunedSize = 0;
+  std::size_t tunedSlots = 0;
+  float tunedPreemption = 0;
+  jino::NetCDFFile::setDefaults(tuning);
+  assert(nc_get_chunk_cache(&tunedSize, &tunedSlots, &tunedPreemption) == NC_NOERR);
+  assert(tunedSize == tuning.cacheSize);
+  jino::NetCDFFile::setDefaults(defaults);
+  assert(nc_get_chunk_cache(&tunedSize, &tunedSlots, &tunedPreemption) == NC_NOERR);
+  assert(tunedSize == size && tunedSlots == slots && tunedPreemption == preemption);
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
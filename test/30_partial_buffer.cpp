@@ -0,0 +1,75 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <netcdf>
+
+#include "Buffer.h"
+#include "Buffers.h"
+#include "Constants.h"
+#include "Data.h"
+#include "JsonReader.h"
+#include "NetCDFData.h"
+#include "Output.h"
+
+int main() {
+  std::cout << "1. Testing partial recording..." << std::endl;
+  const std::uint64_t dataSize = 5;
+  const std::uint64_t numRecords = 3;
+  double x = 0.0;
+  auto xBuffer = jino::Buffer<double>("x", dataSize, x);
+  for (std::uint64_t i = 0; i < numRecords; ++i) {
+    x = static_cast<double>(i) + 0.5;
+    xBuffer.record();
+  }
+  assert(xBuffer.size() == dataSize);
+  assert(xBuffer.getCount() == numRecords);
+
+  std::cout << "2. Testing write of partial buffer..." << std::endl;
+  jino::Data attrs;
+  jino::JsonReader reader;
+  reader.readAttrs(attrs);
+
+  jino::Output output;
+  jino::NetCDFData data;
+  data.addDateToData(&attrs, output.getDate());
+  data.addDimension("dataSize", dataSize);
+
+  output.toFile(data);
+  output.waitForCompletion();
+
+  std::cout << "3. Validating written values..." << std::endl;
+  netCDF::NcFile file(output.getNetCDFPath(), netCDF::NcFile::read);
+  netCDF::NcVar xVar = file.getVar("x");
+  assert(xVar.getDim(0).getSize() == dataSize);
+  std::vector<double> xValues(dataSize);
+  xVar.getVar({0}, {dataSize}, xValues.data());
+  file.close();
+  for (std::uint64_t i = 0; i < numRecords; ++i) {
+    assert(xValues.at(i) == static_cast<double>(i) + 0.5);
+  }
+  for (std::uint64_t i = numRecords; i < dataSize; ++i) {
+    assert(xValues.at(i) == NC_FILL_DOUBLE);  // Unrecorded entries keep the fill value
+  }
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,122 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "StateMembers.h"
+#include "StateParser.h"
+#include "ViewBuffer.h"
+
+using json = nlohmann::json;
+
+class Piston {
+ public:
+  double temperature_;
+  std::int32_t stroke_;
+  bool isFitted_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Piston, temperature_, stroke_, isFitted_)
+};
+
+class Engine {
+ public:
+  std::string name_;
+  std::vector<Piston> pistons_;
+  std::map<std::string, std::uint64_t> serials_;
+
+  JINO_DEFINE_TYPE_INTRUSIVE(Engine, name_, pistons_, serials_)
+};
+
+template <typename T>
+T parse(const std::string& text) {
+  T value;
+  jino::ViewBuffer buffer(text);
+  jino::StateParser parser(buffer);
+  parser.read(value);
+  parser.finish();
+  return value;
+}
+
+template <typename T>
+std::uint8_t isRejected(const std::string& text) {
+  try {
+    static_cast<void>(parse<T>(text));
+  } catch (const std::exception&) {
+    return true;
+  }
+  return false;
+}
+
+int main() {
+  std::cout << "1. Testing parse matches nlohmann..." << std::endl;
+  const std::string text = R"({ "name_" : "V\"8\"\né🚀", "ignored_" : [1, {"a": null}],
+    "pistons_": [{"temperature_": -1.5e2, "stroke_": 3, "isFitted_": true},
+                 {"isFitted_": false, "stroke_": -7, "temperature_": 0.25}],
+    "serials_": {"block": 18446744073709551615, "head": 2} })";
+  const Engine streamed = parse<Engine>(text);
+  const Engine expected = json::parse(text).get<Engine>();
+  assert(streamed.name_ == expected.name_);
+  assert(streamed.serials_ == expected.serials_);
+  assert(streamed.pistons_.size() == expected.pistons_.size());
+  for (std::uint64_t i = 0; i < streamed.pistons_.size(); ++i) {
+    assert(streamed.pistons_[i].temperature_ == expected.pistons_[i].temperature_);
+    assert(streamed.pistons_[i].stroke_ == expected.pistons_[i].stroke_);
+    assert(streamed.pistons_[i].isFitted_ == expected.pistons_[i].isFitted_);
+  }
+
+  std::cout << "2. Testing non-finite values..." << std::endl;
+  const Piston piston = parse<Piston>(R"({"temperature_": null, "stroke_": 1,
+                                          "isFitted_": true})");
+  assert(std::isnan(piston.temperature_) == true);
+
+  std::cout << "3. Testing missing members throw like nlohmann..." << std::endl;
+  const std::string missing = R"({"temperature_": 1.0, "isFitted_": true})";
+  std::uint8_t isMissing = false;
+  try {
+    static_cast<void>(parse<Piston>(missing));
+  } catch (const std::out_of_range&) {
+    isMissing = true;
+  }
+  assert(isMissing == true);
+  assert(isRejected<Piston>(R"({"temperature_": 1.0, "temperature_": 2.0,
+                                "isFitted_": true})") == true);
+  std::uint8_t isNlohmannMissing = false;
+  try {
+    static_cast<void>(json::parse(missing).get<Piston>());
+  } catch (const json::out_of_range&) {
+    isNlohmannMissing = true;
+  }
+  assert(isNlohmannMissing == true);
+
+  std::cout << "4. Testing malformed input is rejected..." << std::endl;
+  assert(isRejected<Piston>(R"({"temperature_": 1.0,)") == true);
+  assert(isRejected<Piston>(R"({"temperature_": 1x, "stroke_": 1, "isFitted_": true})") == true);
+  assert(isRejected<Piston>(R"({"temperature_": 1, "stroke_": 1, "isFitted_": yes})") == true);
+  assert(isRejected<Engine>(R"({"name_": "a", "pistons_": [], "serials_": {}} trailing)") == true);
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}
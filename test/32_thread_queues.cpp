@@ -0,0 +1,70 @@
+/**********************************************************************************************
+* Jino (JSON In NetCDF Out).                                                                  *
+*                                                                                             *
+* (C) Copyright 2025, Phil Underwood.                                                         *
+*                                                                                             *
+* Jino is free software: you can redistribute it and/or modify it under the terms of the GNU  *
+* Lesser General Public License as published by the Free Software Foundation, either version  *
+* 3 of the License, or (at your option) any later version.                                    *
+*                                                                                             *
+* Jino is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without   *
+* even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the   *
+* GNU Lesser General Public License for more details.                                         *
+*                                                                                             *
+* You should have received a copy of the GNU Lesser General Public License along with Jino.   *
+* If not, see <https://www.gnu.org/licenses/>.                                                *
+**********************************************************************************************/
+
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "ThreadQueues.h"
+
+int main() {
+  std::cout << "1. Testing tasks run in order..." << std::endl;
+  jino::ThreadQueues threads;
+  std::vector<std::uint64_t> order;
+  for (std::uint64_t i = 0; i < 100; ++i) {
+    threads.enqueue(0, [&order, i]() {
+      order.push_back(i);
+    });
+  }
+  threads.stopThread(0);
+  assert(order.size() == 100);
+  for (std::uint64_t i = 0; i < order.size(); ++i) {
+    assert(order.at(i) == i);
+  }
+
+  std::cout << "2. Testing tasks enqueued while stopping are not lost..." << std::endl;
+  for (std::uint64_t repeat = 0; repeat < 100; ++repeat) {
+    std::vector<std::future<void>> futures;
+    threads.enqueue(0, []() {});
+    std::thread stopper([&threads]() {
+      threads.stopThread(0);
+    });
+    for (std::uint64_t i = 0; i < 1000; ++i) {
+      auto task = std::make_shared<std::packaged_task<void()>>([]() {});
+      futures.push_back(task->get_future());
+      threads.enqueue(0, [task]() {
+        (*task)();
+      });
+      if (i % 10 == 0) {
+        std::this_thread::yield();  // Spreads the tasks across the stop
+      }
+    }
+    stopper.join();
+    for (auto& future : futures) {
+      assert(future.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+    }
+    threads.stopThreads();
+  }
+  std::cout << "All Passed." << std::endl;
+
+  return 0;
+}